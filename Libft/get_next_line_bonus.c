@@ -12,86 +12,83 @@
 
 #include "libft.h"
 
-static char	*find_next_line(char *str, int line_init)
-{
-	char	*new_str;
-	int		len;
+/**
+ * @brief Read the next block of fd into its buffer
+ * @return 0 when bytes arrived, 2 at end of file, -1 on a read error
+ */
 
-	len = ft_strlen(str) - line_init;
-	if (len <= 0)
-	{
-		free(str);
-		return (NULL);
-	}
-	new_str = ft_substr(str, line_init, len);
-	free(str);
-	return (new_str);
-}
-
-static char	*find_line(char *str, int *line_init)
+static int	refill_buffer(t_gnl_buffer *buffer, int fd)
 {
-	char	*line;
-	int		i;
+	ssize_t	read_bytes;
 
-	i = 0;
-	while (str[i] && str[i] != '\n')
-		i++;
-	if (str[i] == '\n')
-		*line_init = i + 1;
-	else
-	{
-		*line_init = i;
-		if (i == 0 && str[i] == '\0')
-			return (NULL);
-	}
-	line = ft_substr(str, 0, *line_init);
-	return (line);
+	buffer->start = 0;
+	buffer->end = 0;
+	read_bytes = read(fd, buffer->data, BUFFER_SIZE);
+	if (read_bytes < 0)
+		return (-1);
+	if (read_bytes == 0)
+		return (2);
+	buffer->end = read_bytes;
+	return (0);
 }
 
-static char	*read_str(int fd, char *buffer, char *str)
+/**
+ * @brief Move buffered bytes up to and including the next newline
+ * @return 1 once the line is complete, 0 if more input is needed,
+ * -1 on allocation failure
+ */
+
+static int	take_buffered(t_gnl_buffer *buffer, t_gnl_line *line)
 {
-	int		read_bytes;
-	char	*temp;
+	char	*newline;
+	size_t	n;
 
-	while (!ft_strchr(str, '\n'))
-	{
-		read_bytes = read(fd, buffer, BUFFER_SIZE);
-		if (read_bytes == 0 && str[0] == '\0')
-		{
-			free(str);
-			return (NULL);
-		}
-		if (read_bytes <= 0)
-			return (str);
-		buffer[read_bytes] = '\0';
-		temp = ft_strjoin(str, buffer);
-		free(str);
-		str = temp;
-	}
-	return (str);
+	n = buffer->end - buffer->start;
+	newline = ft_memchr(buffer->data + buffer->start, '\n', n);
+	if (newline)
+		n = newline - (buffer->data + buffer->start) + 1;
+	if (!gnl_line_append(line, buffer->data + buffer->start, n))
+		return (-1);
+	buffer->start += n;
+	return (newline != NULL);
 }
 
+/**
+ * @brief Read the next line from fd
+ *
+ * Each fd gets its own BUFFER_SIZE read buffer, allocated on first use
+ * and kept across calls, so a line costs one copy out of it and read()
+ * runs once per buffer, not once per line. Lines longer than the buffer
+ * grow geometrically. The buffer is freed when the input ends.
+ *
+ * @return The line, or NULL: errno is 0 at the end of the input and holds
+ * the cause when a read or an allocation failed
+ */
+
 char	*get_next_line(int fd)
 {
-	char		*buffer;
-	char		*line;
-	static char	*str[FOPEN_MAX];
-	int			line_init;
+	t_gnl_buffer	*buffer;
+	t_gnl_line		line;
+	int				status;
 
-	if (fd < 0 || BUFFER_SIZE <= 0 || read(fd, 0, 0) < 0)
-		return (NULL);
-	if (str[fd] == NULL)
-		str[fd] = ft_strdup("");
-	buffer = (char *)malloc(sizeof(char) * (BUFFER_SIZE + 1));
-	if (!buffer)
-		return (NULL);
-	str[fd] = read_str(fd, buffer, str[fd]);
-	free(buffer);
-	if (!str[fd])
-		return (NULL);
-	line = find_line(str[fd], &line_init);
-	if (!line && !str[fd])
-		return (NULL);
-	str[fd] = find_next_line(str[fd], line_init);
-	return (line);
+	ft_bzero(&line, sizeof(line));
+	buffer = gnl_buffer(fd);
+	status = -1;
+	if (buffer)
+		status = 0;
+	while (status == 0)
+	{
+		if (buffer->start == buffer->end)
+			status = refill_buffer(buffer, fd);
+		if (status == 0)
+			status = take_buffered(buffer, &line);
+	}
+	if (status != 1)
+		get_next_line_release(fd);
+	if (status == 2 && !line.text)
+		errno = 0;
+	if (status >= 0)
+		return (line.text);
+	free(line.text);
+	return (NULL);
 }
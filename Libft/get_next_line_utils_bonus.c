@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_utils_bonus.c                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/**
+ * @brief Append n bytes to the line, doubling its capacity when needed
+ */
+
+int	gnl_line_append(t_gnl_line *line, const char *src, size_t n)
+{
+	char	*grown;
+	size_t	cap;
+
+	if (line->len + n + 1 > line->cap)
+	{
+		cap = line->cap * 2;
+		if (cap < line->len + n + 1)
+			cap = line->len + n + 1;
+		grown = malloc(cap);
+		if (!grown)
+			return (0);
+		if (line->text)
+			ft_memcpy(grown, line->text, line->len);
+		free(line->text);
+		line->text = grown;
+		line->cap = cap;
+	}
+	ft_memcpy(line->text + line->len, src, n);
+	line->len += n;
+	line->text[line->len] = '\0';
+	return (1);
+}
+
+/**
+ * @brief The table of per-fd read buffers shared by every thread
+ */
+
+static t_gnl_table	*gnl_table(void)
+{
+	static t_gnl_table	table = {PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0};
+
+	return (&table);
+}
+
+/**
+ * @brief Grow the table so fd has a slot, doubling its size
+ */
+
+static int	grow_table(t_gnl_table *table, int fd)
+{
+	t_gnl_buffer	**slots;
+	size_t			size;
+
+	size = table->size * 2;
+	if (size < 16)
+		size = 16;
+	while (size <= (size_t)fd)
+		size *= 2;
+	slots = ft_calloc(size, sizeof(*slots));
+	if (!slots)
+		return (0);
+	if (table->slots)
+		ft_memcpy(slots, table->slots, table->size * sizeof(*slots));
+	free(table->slots);
+	table->slots = slots;
+	table->size = size;
+	return (1);
+}
+
+/**
+ * @brief The read buffer of fd, allocated on first use
+ *
+ * Growth, lookup and release hold the table lock, so threads reading
+ * different fds never see the slots moved or freed under them. A buffer
+ * itself is only used by the thread reading its fd.
+ * @return NULL with errno set when fd is negative or an allocation failed
+ */
+
+t_gnl_buffer	*gnl_buffer(int fd)
+{
+	t_gnl_table		*table;
+	t_gnl_buffer	*buffer;
+
+	if (fd < 0 || BUFFER_SIZE <= 0)
+	{
+		errno = EBADF;
+		return (NULL);
+	}
+	table = gnl_table();
+	pthread_mutex_lock(&table->lock);
+	buffer = NULL;
+	if ((size_t)fd < table->size || grow_table(table, fd))
+		buffer = table->slots[fd];
+	if (!buffer && (size_t)fd < table->size)
+		buffer = malloc(sizeof(t_gnl_buffer));
+	if (buffer && !table->slots[fd])
+	{
+		buffer->start = 0;
+		buffer->end = 0;
+		table->slots[fd] = buffer;
+		table->used++;
+	}
+	pthread_mutex_unlock(&table->lock);
+	return (buffer);
+}
+
+/**
+ * @brief Drop whatever get_next_line still buffers for fd, and the table
+ * with the last buffer. Call it before closing an fd that was not read to
+ * its end, or the next file opened on that number starts with stale bytes
+ */
+
+void	get_next_line_release(int fd)
+{
+	t_gnl_table	*table;
+
+	table = gnl_table();
+	pthread_mutex_lock(&table->lock);
+	if (fd >= 0 && (size_t)fd < table->size && table->slots[fd])
+	{
+		free(table->slots[fd]);
+		table->slots[fd] = NULL;
+		table->used--;
+	}
+	if (table->used == 0)
+	{
+		free(table->slots);
+		table->slots = NULL;
+		table->size = 0;
+	}
+	pthread_mutex_unlock(&table->lock);
+}
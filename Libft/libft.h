@@ -13,7 +13,7 @@
 #ifndef LIBFT_H
 # define LIBFT_H
 # ifndef BUFFER_SIZE
-#  define BUFFER_SIZE 1
+#  define BUFFER_SIZE 65536
 # endif
 
 # include <stdlib.h>
@@ -24,6 +24,7 @@
 # include <fcntl.h>
 # include <stdio.h>
 # include <errno.h>
+# include <pthread.h>
 
 typedef struct s_list
 {
@@ -51,6 +52,28 @@ typedef struct s_snprintf_data
 	size_t	pos;
 }	t_snprintf_data;
 
+typedef struct s_gnl_buffer
+{
+	char	data[BUFFER_SIZE];
+	size_t	start;
+	size_t	end;
+}	t_gnl_buffer;
+
+typedef struct s_gnl_table
+{
+	pthread_mutex_t	lock;
+	t_gnl_buffer	**slots;
+	size_t			size;
+	size_t			used;
+}	t_gnl_table;
+
+typedef struct s_gnl_line
+{
+	char	*text;
+	size_t	len;
+	size_t	cap;
+}	t_gnl_line;
+
 typedef struct s_printf
 {
 	int		fd;
@@ -123,6 +146,9 @@ void	ft_putunsignednbr_printf(unsigned int nb, size_t *i);
 void	ft_putptr_printf(void *ptr, size_t *i);
 
 char	*get_next_line(int fd);
+void	get_next_line_release(int fd);
+int		gnl_line_append(t_gnl_line *line, const char *src, size_t n);
+t_gnl_buffer	*gnl_buffer(int fd);
 
 void	ft_error(char *str);
 void	ft_perror(char *str);
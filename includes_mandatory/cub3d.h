@@ -26,6 +26,12 @@
 # include <mlx.h>
 # include <math.h>
 # include <limits.h>
+# include <sys/time.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <stdint.h>
+# include <pthread.h>
+# include <setjmp.h>
 # include "keys.h"
 # include "game_struct.h"
 # include "../Libft/libft.h"
@@ -38,20 +44,24 @@
 //# define EASTT 'E'
 //# define WESTT 'W'
 //# define SPACE ' '
-# define MAX_MAP_LINES 1000
 
 /* Error messages */
-# define ERR_FILE_EXT "File must have .cub extension"
+# define ERR_FILE_EXT "File must have .cub or .cubc extension"
 # define ERR_FILE_OPEN "Cannot open file"
+# define ERR_FILE_READ "Error\nCannot read map file\n"
 # define ERR_MALLOC "Memory allocation failed"
 # define ERR_INVALID "Invalid map"
 # define ERR_NO_PLAYER "No player found in map"
 # define ERR_MULTI_PLAYER "Multiple players found"
 # define ERR_MAP_NOT_CLOSED "Error\nMap is not surrounded by walls\n"
+# define ERR_MAP_NOT_ENCLOSED "Error\nMap is not properly enclosed by walls\n"
 # define ERR_INVALID_CHAR "Invalid character in map"
 # define ERR_MISSING_TEXTURE "Missing texture path"
 # define ERR_INVALID_COLOR "Invalid color format"
-# define ERR_INVALID_MAP "Error\nInvalid character '/' found in map data\n"
+# define ERR_INVALID_MAP "Error\nInvalid character found in map data\n"
+# define ERR_CUBC "Error\nInvalid or corrupt compiled map\n"
+# define ERR_CUBC_VERSION "Error\nUnsupported compiled map version\n"
+# define ERR_CUBC_BYTE_ORDER "Error\nCompiled map has the wrong byte order\n"
 
 /* ************************************************************************** */
 /*                               CONSTANTS                                    */
@@ -60,11 +70,74 @@
 /* Window and display settings */
 # define DEFAULT_WIDTH	1940	/* Default window width */
 # define DEFAULT_HEIGHT	1280	/* Default window height */
-# define TEXTURE_SIZE	128		/* Size of wall textures (128x128) */
+
+/* In-tree texture decoders (XPM, QOI, binary PPM) */
+# define TEXTURE_MAX_SIDE		16384		/* Largest texture side accepted */
+# define TEXTURE_PROBE_BYTES	4096		/* Read to check a texture header */
+# define TEXTURE_TRANSPARENT	0xFF000000	/* Pixel value MLX uses for None */
+# define XPM_NO_COLOR			0x01000000	/* Palette slot with no key */
+
+/* Decoded texture cache: <cache dir>/cub3D/<source hash>.bgra */
+# define TEX_BLOB_MAGIC		0x58455443	/* "CTEX" read as a little-endian u32 */
+# define TEX_BLOB_VERSION	1
+# define TEX_CACHE_PATH		1024		/* Longest blob path accepted */
+
+/* Texture residency */
+# ifndef TEXTURE_BUDGET
+#  define TEXTURE_BUDGET	67108864	/* Bytes of wall textures kept loaded */
+# endif
+# define TEXTURE_PLACEHOLDER	0x808080	/* Until the average is known */
 
 /* Movement and rotation speeds */
 # define MOVE_SPEED		0.02	/* Player movement speed */
 # define ROTATION_SPEED	0.03	/* Player rotation speed */
+# define SIM_TICK_US	8333	/* Simulation tick, 120 per second */
+# define SIM_MAX_LAG	8		/* Ticks of lag caught up before skipping */
+# define MOUSE_SENSITIVITY	0.002	/* Radians turned per pointer pixel */
+
+/* Collision */
+# define PLAYER_RADIUS		0.2		/* Player circle radius in cells */
+# define COLLISION_PASSES	8		/* Sweeps resolved per move */
+# define COLLISION_SKIN		1e-6	/* Gap kept from a wall after a contact */
+# define COLLISION_EPSILON	1e-9	/* Tolerance for starting on a face */
+# define CELL_HALF_DIAGONAL	0.70710678118654752
+
+/* Parsing */
+# define ARENA_BLOCK_SIZE	65536	/* Bytes per parse arena block */
+# ifndef MAP_THREADS
+#  define MAP_THREADS	0		/* Map validation bands, 0 = online CPUs */
+# endif
+# define MAP_MAX_THREADS	64
+# define MAP_BAND_MIN_ROWS	256	/* Fewest rows worth a thread */
+
+/* Map acceleration */
+# define DIST_FIELD_MIN_MEAN	16	/* Mean wall distance to keep the field */
+# define DIST_FIELD_MAX_CELLS	67108864	/* Skip the field above 64M cells */
+
+/* Compiled maps (.cubc), little-endian only */
+# if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#  error "cub3D needs a little-endian host: .cubc maps are used in place"
+# endif
+# define CUBC_MAGIC		0x43425543	/* "CUBC" read as a little-endian u32 */
+# define CUBC_MAGIC_SWAPPED	0x43554243	/* Same, written big-endian */
+# define CUBC_VERSION	2
+# define CUBC_VALIDATED	1			/* Header flag: closure check passed */
+# define CUBC_HASH_SEED		0xcbf29ce484222325ULL
+# define CUBC_HASH_PRIME	0x100000001b3ULL
+# define CUBC_HASH_SLICE	8388608	/* Bytes hashed before they are released */
+# define BYTES_LOW		0x0101010101010101ULL	/* 0x01 in every byte */
+# define BYTES_HIGH		0x8080808080808080ULL	/* 0x80 in every byte */
+
+/* Input recording */
+# define REC_MAGIC		0x43455243	/* "CREC" read as a little-endian u32 */
+# define REC_VERSION	1
+
+/* Map chunks: 64x64 cells, one 4 KiB page of grid chars each */
+# define CHUNK_BYTES		4096
+# define CHUNK_BITS_BYTES	512	/* 64 words of 8x8 tiles */
+# define MAP_CHUNK_BUDGET	268435456	/* Default bytes of chunks resident */
+# define MAP_CHUNK_RADIUS	2	/* Chunks kept around the player */
+# define MAP_PREFETCH_CHUNKS	4	/* How far ahead the pager reads */
 
 /* Minimap settings */
 # define MINIMAP_SCALE	7		/* Scale factor for minimap */
@@ -91,13 +164,193 @@ enum e_direction
 	WEST = 3
 };
 
-typedef struct s_scan_data
+/**
+ * @brief Kinds of event queued by the X callbacks
+ */
+enum e_input_type
+{
+	INPUT_KEY_PRESS,
+	INPUT_KEY_RELEASE,
+	INPUT_MOTION,
+	INPUT_TICK
+};
+
+/**
+ * @brief What --record / --replay is doing with the session
+ */
+enum e_session_mode
+{
+	SESSION_OFF,
+	SESSION_RECORD,
+	SESSION_REPLAY
+};
+
+/**
+ * @brief View of one token inside a header line, not NUL-terminated
+ */
+typedef struct s_token
+{
+	const char	*start;
+	size_t		len;
+}	t_token;
+
+/**
+ * @brief Explicit stack of (x, y) seeds for the scanline flood fill
+ */
+typedef struct s_fill_stack
+{
+	int		*seeds;
+	size_t	count;
+	size_t	capacity;
+}	t_fill_stack;
+
+/**
+ * @brief Horizontal band of grid rows scanned by one validation thread
+ */
+typedef struct s_band
+{
+	t_map	*map;
+	int		first;
+	int		last;
+	int		width;
+	int		players;
+	int		player_row;
+	int		player_col;
+	char	player_dir;
+	int		closed;
+}	t_band;
+
+/**
+ * @brief Outcome of validating one map in --validate mode
+ */
+typedef struct s_batch_result
+{
+	const char	*error;
+	int			width;
+	int			height;
+	long long	elapsed_us;
+}	t_batch_result;
+
+/**
+ * @brief Shared work queue of the --validate worker pool
+ */
+typedef struct s_batch
 {
-	t_game	*game;
-	int		row;
-	int		base;
-	int		*player_count;
-}	t_scan_data;
+	char			**files;
+	t_batch_result	*results;
+	int				count;
+	int				next;
+	int				workers;
+	int				map_threads;
+	pthread_mutex_t	lock;
+}	t_batch;
+
+/**
+ * @brief Header of a compiled .cubc map, at offset 0
+ *
+ * Every field and section is little-endian, and the bitmaps and the
+ * row scans use them straight from the mapping, so the build refuses
+ * big-endian hosts rather than swapping. The magic doubles as a
+ * byte-order mark: a file that reads it swapped is refused.
+ *
+ * It is followed by the four NUL-terminated texture paths (NO, SO, WE,
+ * EA), the grid as chunks_w x chunks_h chunks of 64x64 chars (one 4 KiB
+ * page each, row-major inside, space-padded past the map edge), the wall
+ * bitmap in the same chunk order (64 words of 8x8 tiles per chunk) and
+ * one macro_bits word per chunk. The grid starts on a 4 KiB boundary so
+ * a chunk is a page and can be paged in and out on its own. checksum is
+ * FNV-1a over the 64-bit words after the header, then over the header
+ * words with checksum set to 0.
+ */
+typedef struct s_cubc_header
+{
+	uint32_t	magic;
+	uint32_t	version;
+	uint32_t	width;
+	uint32_t	height;
+	uint32_t	chunks_w;
+	uint32_t	chunks_h;
+	uint32_t	player_x;
+	uint32_t	player_y;
+	uint8_t		player_dir;
+	uint8_t		flags;
+	uint8_t		floor_rgb[3];
+	uint8_t		ceiling_rgb[3];
+	uint32_t	texture_offsets[4];
+	uint64_t	grid_offset;
+	uint64_t	bits_offset;
+	uint64_t	macro_offset;
+	uint64_t	file_size;
+	uint64_t	checksum;
+}	t_cubc_header;
+
+/**
+ * @brief Header of a --record file, followed by its entries; start is
+ * the pose checksum before the first tick, so replaying on another map
+ * or spawn is caught at once
+ */
+typedef struct s_rec_header
+{
+	uint32_t	magic;
+	uint32_t	version;
+	uint32_t	ticks;
+	uint32_t	events;
+	double		sensitivity;
+	uint64_t	start;
+}	t_rec_header;
+
+/**
+ * @brief One RGBA pixel; a struct so copies stay plain assignments
+ */
+typedef struct s_rgba
+{
+	uint8_t		c[4];
+}	t_rgba;
+
+/**
+ * @brief QOI decoder state: current pixel, the 64-entry index of
+ * recently seen pixels and the pending run length
+ */
+typedef struct s_qoi
+{
+	t_rgba		px;
+	t_rgba		index[64];
+	int			run;
+}	t_qoi;
+
+/**
+ * @brief One swept-circle query: centre p moving by d with radius r;
+ * t is the fraction of d travelled before the first contact, n the
+ * contact normal and hit 1 for a face or 2 for a corner; cell is the
+ * wall cell under test and in the input a slide has left to apply
+ */
+typedef struct s_sweep
+{
+	double		in[2];
+	double		p[2];
+	double		d[2];
+	double		r;
+	double		len2;
+	double		t;
+	double		n[2];
+	int			cell[2];
+	int			hit;
+}	t_sweep;
+
+/**
+ * @brief Header of a cached decoded texture, followed by width * height
+ * BGRA pixels; 64 bytes so the pixels are aligned in the mapping
+ */
+typedef struct s_tex_blob
+{
+	uint32_t	magic;
+	uint32_t	version;
+	uint32_t	width;
+	uint32_t	height;
+	uint64_t	source_hash;
+	uint64_t	source_size;
+	uint64_t	reserved[4];
+}	t_tex_blob;
 
 /* ************************************************************************** */
 /*                           FUNCTION PROTOTYPES                             */
@@ -108,18 +361,36 @@ typedef struct s_scan_data
 /* ========================================================================== */
 
 void	init_game_structure(t_game *game);
+long long	get_time_us(void);
+void	print_map_load_report(t_game *game, long long *stamps);
+void	print_first_frame_report(t_game *game);
+t_alloc_count	*alloc_counter(void);
+void	*__real_malloc(size_t size);
+void	*__wrap_malloc(size_t size);
+void	*__real_calloc(size_t count, size_t size);
+void	*__wrap_calloc(size_t count, size_t size);
+void	start_startup_report(t_game *game);
+long long	record_startup_phase(t_game *game, const char *name);
+void	record_texture_phase(t_game *game, t_tex_entry *e);
+void	finish_startup_report(t_game *game);
+int		run_batch_validation(int count, char **files);
+int		print_batch_report(t_batch *batch, long long elapsed_us);
+int		compile_map_file(int count, char **args);
 
 /* ========================================================================== */
 /*                            VALIDATION FUNCTIONS                           */
 /* ========================================================================== */
 int		is_valid_file_descriptor(int fd);
+int		parse_launch_options(t_game *game, int *argc, char ***argv);
+int		apply_tuning_option(t_game *game, char *arg);
+int		parse_batch_threads(t_batch *batch, int *count, char ***files);
 int		validate_arguments(int argc, char **argv);
 int		is_parseable_map_file(t_game *game, int fd);
 int		validate_input_file(char *filename);
+int		has_file_extension(char *filename, char *ext);
 bool	validate_open_walls(t_game *game);
 int		free_double_ptr(char **ptr);
-char	**create_temp_map(t_map *game);
-int		flood_fill(char **map, int y, int x, t_map *game);
+int		flood_fill(t_map *map, uint8_t *cells, int x, int y);
 void	print_error(char *message);
 
 /* ========================================================================== */
@@ -131,6 +402,8 @@ void	cleanup_mlx_resources(t_game *game);
 void	free_texture_paths(t_game *game);
 void	free_string_array(char **array);
 void	free_parsing_buffers(t_game *game);
+void	cleanup_parsing_error(t_game *game);
+void	free_map_grid(t_map *map);
 int		clean_exit_program(t_game *game);
 
 /* ========================================================================== */
@@ -141,6 +414,28 @@ void	handle_parsing_error(t_game *game, char *error_message);
 int		read_and_parse_map_file(int file_descriptor, t_game *game);
 int		parse_map_file(t_game *game, int file_descriptor);
 void	normalize_map_dimensions(t_game *g);
+void	append_map_row(t_game *game, const char *text, size_t len);
+void	finish_map_rows(t_game *game);
+int		map_cub_file(int fd, t_map *map);
+void	unmap_cub_file(t_map *map);
+void	advise_range(void *addr, size_t len, int advice);
+int		scan_mapped_cub_file(t_game *g);
+void	*arena_alloc(t_arena *arena, size_t size);
+char	*arena_strndup(t_arena *arena, const char *src, size_t len);
+void	arena_release(t_arena *arena);
+uint64_t	cubc_hash(uint64_t hash, const void *data, size_t size);
+void	texture_path_slots(t_game *game, char ***slots);
+int		load_compiled_map(t_game *game, int fd);
+void	check_compiled_grid(t_game *game, t_cubc_header *h);
+int		compiled_row_words(int width);
+void	load_compiled_band(t_map *map, int cy, char *slot, int masks);
+void	check_compiled_row(const char *row, uint64_t **space, t_band *band);
+int		write_compiled_map(t_game *game, int fd);
+void	start_chunk_pager(t_map *map, double x, double y);
+void	stop_chunk_pager(t_map *map);
+void	update_chunk_pager(t_game *game);
+void	admit_chunk_window(t_map *map, int cx, int cy);
+void	trim_chunk_pages(t_map *map);
 
 /* ========================================================================== */
 /*                            PARSING UTILITIES                              */
@@ -150,11 +445,6 @@ int		is_character_valid(char character, char *valid_chars);
 int		is_number(const char *s);
 int		count_elems(char **v);
 int		get_string_length_no_newline(char *string);
-char	*resize(char *org_str, int target_size);
-char	*join_strings(char *first_string, char *second_string);
-int		count_elems(char **v);
-void	strip_trailing_nl(char *s);
-int		is_number(const char *s);
 
 /* ========================================================================== */
 /*                          WALL VALIDATION                                  */
@@ -165,6 +455,16 @@ int		validate_vertical_walls(t_game *game, int start_row, int start_col);
 int		validate_map_line(t_game *game, char *line_to_check, int start_col);
 int		validate_horizontal_walls(t_game *game, int start_row, int start_col);
 bool	validate_map_walls(t_game *game);
+
+/* ========================================================================== */
+/*                          MAP ACCELERATION                                 */
+/* ========================================================================== */
+
+void	build_wall_bitmap(t_game *game);
+int		is_wall_cell(t_map *map, int x, int y);
+void	free_map_acceleration(t_map *map);
+void	build_distance_field(t_game *game);
+
 int		validate_parsed_map(t_game *game);
 
 /* ========================================================================== */
@@ -173,8 +473,11 @@ int		validate_parsed_map(t_game *game);
 
 void	set_player_position_and_direction(t_game *game, char direction,
 			int row, int col);
-void	calculate_map_dimensions(t_game *game, char **map_array,
-			int start_row, int start_col);
+void	set_player_position(t_game *game, char direction, int row, int col);
+void	calculate_map_dimensions(t_game *game);
+int		scan_row(char *row, int y, t_band *band);
+int		is_enclosed_row(const char *above, const char *row,
+			const char *below);
 int		extract_map_statistics(t_game *game, char *config_line);
 void	validate_configuration_completeness(t_game *game);
 
@@ -184,10 +487,11 @@ void	validate_configuration_completeness(t_game *game);
 
 void	extract_texture_path(t_game *game, char **texture_path,
 			char **split_line);
-void	extract_texture(t_game *game, char **tex_path, char **split_line);
-int		validate_rgb_line_format(char *rgb_line);
-void	extract_rgb_colors(t_game *game, int *rgb_array, char **split_line);
-int		parse_and_validate_rgb_values(int *rgb, char *rgb_line);
+int		next_header_token(const char **cursor, t_token *token);
+int		tokenize_header_line(const char *line, t_token *tokens, int max);
+void	extract_texture(t_game *game, char **tex_path, char *config_line);
+int		parse_rgb_token(const t_token *token, int *rgb);
+void	extract_rgb_colors(t_game *game, int *rgb_array, char *config_line);
 
 /* ========================================================================== */
 /*                             GAME INITIALIZATION                           */
@@ -196,6 +500,27 @@ int		parse_and_validate_rgb_values(int *rgb, char *rgb_line);
 void	handle_game_error(t_game *game, char *error_message);
 void	init_game_settings(t_game *game);
 void	init_mlx_images(t_game *game);
+t_tex_entry	*find_texture_entry(t_game *game, char *path);
+void	set_face_images(t_game *game, t_tex_entry *e);
+void	release_texture_entries(t_game *game);
+void	request_texture_entry(t_tex_entry *e);
+void	upload_texture_entry(t_game *game, t_tex_entry *e);
+int		wall_texture_ready(t_game *game, int face);
+void	update_texture_residency(t_game *game);
+void	finish_texture_decoding(t_game *game);
+int		decode_texture(char *buf, size_t size, t_tex_entry *e);
+int		decode_xpm(char *buf, t_tex_entry *e);
+int		decode_qoi(const uint8_t *in, size_t size, t_tex_entry *e);
+int		decode_ppm(const uint8_t *in, size_t size, t_tex_entry *e);
+int		probe_qoi(const uint8_t *in, size_t size, t_tex_entry *e);
+size_t	probe_ppm(const uint8_t *in, size_t size, int *hdr);
+int		probe_xpm(char **cursor, int *hdr);
+char	*next_xpm_string(char **cursor);
+int		probe_texture_file(t_tex_entry *e);
+uint64_t	hash_texture_source(const char *buf, size_t size);
+int		load_cached_texture(t_tex_entry *e, uint64_t hash, size_t size);
+void	store_cached_texture(t_tex_entry *e, uint64_t hash, size_t size);
+void	release_texture_pixels(t_tex_entry *e);
 int		init_game_engine(t_game *game);
 
 /* ========================================================================== */
@@ -208,6 +533,20 @@ int		handle_mouse_rotation(int mouse_x, int mouse_y, t_game *game);
 int		handle_key_press(int keycode, t_game *game);
 int		handle_key_release(int keycode, t_game *game);
 void	process_movement_input(t_game *game);
+int		push_input_event(t_input_ring *ring, int type, int a, int b);
+double	drain_input_events(t_game *game);
+void	record_input_latency(t_game *game);
+void	record_replay_frame(t_game *game);
+void	print_input_report(t_game *game);
+uint64_t	pose_checksum(t_player *player);
+void	record_session_entry(t_game *game, int type, int a, int b);
+int		open_session(t_game *game);
+void	close_session(t_game *game);
+int		begin_session_tick(t_game *game);
+void	end_session_tick(t_game *game);
+void	start_simulation(t_game *game);
+void	stop_simulation(t_game *game);
+void	take_pose_snapshot(t_game *game);
 
 /* ========================================================================== */
 /*                           PLAYER MOVEMENT                                 */
@@ -216,11 +555,9 @@ void	process_movement_input(t_game *game);
 void	move_player_with_collision(t_game *game, double delta_x,
 			double delta_y);
 void	rotate_player_view(t_game *game, double rotation_speed);
-void	handle_diagonal_movement(t_game *game, double new_x, double new_y);
-void	handle_single_axis_movement(t_game *game, double delta_x,
-			double delta_y);
-void	revert_invalid_position(t_game *game, double delta_x, double delta_y);
-int		is_wall_at_position(t_game *game, int x, int y);
+void	slide_circle(t_map *map, double *pos, double dx, double dy);
+void	sweep_wall_grid(t_sweep *s, t_map *map);
+double	plan_collision_pass(t_sweep *s, t_map *map, double *pos);
 
 /* ========================================================================== */
 /*                            RAYCASTING ENGINE                              */
@@ -229,6 +566,9 @@ int		is_wall_at_position(t_game *game, int x, int y);
 void	calculate_delta_distances(t_game *game);
 void	calculate_step_and_side_distances(t_game *game);
 void	execute_dda_algorithm(t_game *game);
+void	leave_open_area(t_ray *ray, int cells_x, int cells_y);
+void	skip_empty_block(t_ray *ray, int block_size);
+void	walk_distance_field(t_ray *ray, t_map *map);
 void	init_raycasting_for_column(t_game *game, int screen_x);
 void	execute_raycasting(t_game *game);
 
@@ -247,7 +587,7 @@ void	put_pixel_to_image(t_game *game, int x, int y, int color);
 void	draw_wall_column(t_game *game, int screen_x);
 int		render_frame(t_game *game);
 void	calculate_texture_coordinates(t_game *game, int line_start,
-			int line_height);
+			int line_height, int texture_index);
 
 /* ========================================================================== */
 /*                           BACKGROUND RENDERING                            */
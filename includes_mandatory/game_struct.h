@@ -43,6 +43,59 @@ typedef struct s_mlx
 	int		height;
 }	t_mlx;
 
+/**
+ * @brief Chunk of a bump allocator; its data follows the header
+ */
+typedef struct s_arena_block
+{
+	struct s_arena_block	*next;
+	size_t					used;
+	size_t					size;
+}	t_arena_block;
+
+/**
+ * @brief Bump allocator for parse-time temporaries, freed in one go
+ */
+typedef struct s_arena
+{
+	t_arena_block	*head;
+}	t_arena;
+
+/**
+ * @brief Map row seen while parsing, not NUL-terminated
+ */
+typedef struct s_row_view
+{
+	const char	*text;
+	size_t		len;
+}	t_row_view;
+
+/**
+ * @brief Background pager for the chunks of a mapped .cubc map
+ *
+ * target holds the player's chunk and the chunk ahead of it (x, y pairs),
+ * written by the game loop under lock. The pager keeps the chunks it
+ * admitted in an LRU list (prev/next indices, head is the most recent).
+ */
+typedef struct s_pager
+{
+	pthread_t		thread;
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+	int				running;
+	int				stop;
+	unsigned int	generation;
+	int				target[4];
+	double			last_pos[2];
+	int				*prev;
+	int				*next;
+	uint8_t			*admitted;
+	int				head;
+	int				tail;
+	size_t			count;
+	size_t			budget;
+}	t_pager;
+
 /**
  * @brief Map configuration and data
  */
@@ -54,7 +107,29 @@ typedef struct s_map
 	int			floor_rgb[3];
 	int			ceiling_rgb[3];
 	char		*current_line;
-	char		*data_buffer;
+	t_arena		arena;
+	t_row_view	*rows;
+	int			row_count;
+	int			row_capacity;
+	int			rows_closed;
+	int			threads;
+	size_t		chunk_budget;
+	int			elements;
+	jmp_buf		*bail;
+	const char	*error;
+	char		*file_data;
+	size_t		file_size;
+	int			compiled;
+	char		*chunk_cells;
+	uint64_t	*wall_bits;
+	int			tiles_w;
+	int			tiles_h;
+	uint64_t	*macro_bits;
+	int			macros_w;
+	int			macros_h;
+	int			empty_blocks;
+	uint8_t		*wall_distance;
+	t_pager		pager;
 }	t_map;
 /**
  * @brief Player position, direction and movement
@@ -70,6 +145,7 @@ typedef struct s_player
 	char		initial_dir;
 	double		move_speed;
 	double		rotate_speed;
+	double		mouse_sensitivity;
 	int			key_w;
 	int			key_s;
 	int			key_a;
@@ -101,6 +177,9 @@ typedef struct s_ray
 
 /**
  * @brief Wall rendering and texture data
+ *
+ * tex_width and tex_height are the decoded size of the texture the
+ * current column samples; tex_x and tex_y stay inside them.
  */
 
 typedef struct s_wall
@@ -108,6 +187,8 @@ typedef struct s_wall
 	double		hit_x;
 	int			tex_x;
 	int			tex_y;
+	int			tex_width;
+	int			tex_height;
 	double		tex_step;
 	double		tex_pos;
 	int			line_height;
@@ -115,19 +196,211 @@ typedef struct s_wall
 	int			draw_end;
 }	t_wall;
 
+/**
+ * @brief One decoded texture file, shared by every face that names it
+ *
+ * pixels holds the in-tree decoder's output until it is copied into
+ * the MLX image; when it came from the disk cache it points into blob,
+ * a read-only mapping. pending is set from the renderer's request until
+ * the upload, decoding while a worker owns the entry, and ready, guarded
+ * by lock, once the decode has finished. mlx_ptr is only set while the
+ * texture is resident; average is drawn in its place.
+ */
+typedef struct s_tex_entry
+{
+	char			*path;
+	void			*mlx_ptr;
+	int				width;
+	int				height;
+	uint32_t		*pixels;
+	void			*blob;
+	size_t			blob_size;
+	pthread_t		thread;
+	pthread_mutex_t	*lock;
+	int				pending;
+	int				decoding;
+	int				ready;
+	int				disk_cache;
+	int				average;
+	unsigned long	last_used;
+	long long		requested_us;
+}	t_tex_entry;
+
 /**
  * @brief Texture management system
+ *
+ * face maps NORTH..WEST to the cache entry drawn on that side. resident
+ * counts the bytes of uploaded wall textures, kept under budget by
+ * evicting the ones least recently seen; frame numbers those sightings
+ * and flat_columns counts the columns drawn untextured in this frame.
  */
 typedef struct s_textures
 {
-	t_image		north;
-	t_image		south;
-	t_image		east;
-	t_image		west;
-	t_image		screen;
-	t_image		minimap;
+	t_image			north;
+	t_image			south;
+	t_image			east;
+	t_image			west;
+	t_image			screen;
+	t_image			minimap;
+	t_tex_entry		cache[4];
+	t_tex_entry		*face[4];
+	int				cache_count;
+	int				disk_cache;
+	pthread_mutex_t	lock;
+	int				lock_ready;
+	size_t			budget;
+	size_t			resident;
+	unsigned long	frame;
+	int				flat_columns;
 }	t_textures;
 
+/**
+ * @brief Calls and bytes requested from malloc since launch
+ */
+typedef struct s_alloc_count
+{
+	size_t		count;
+	size_t		bytes;
+}	t_alloc_count;
+
+/**
+ * @brief One --startup-report row; texture rows carry a path and only
+ * a wall time, since their decode overlaps the other phases
+ */
+typedef struct s_phase
+{
+	const char	*name;
+	const char	*path;
+	long long	us;
+	size_t		allocs;
+	size_t		bytes;
+}	t_phase;
+
+# define STARTUP_MAX_PHASES	32	/* Rows kept by --startup-report */
+
+/**
+ * @brief --startup-report state: the rows so far and where the current
+ * phase started
+ */
+typedef struct s_startup
+{
+	int				enabled;
+	int				count;
+	t_phase			phases[STARTUP_MAX_PHASES];
+	long long		mark_us;
+	t_alloc_count	mark;
+}	t_startup;
+
+# define INPUT_RING_SIZE	256	/* Pending input events, a power of two */
+
+/**
+ * @brief One input event as the X callbacks saw it: a key code in a, or
+ * the pointer position in a and b, and when it arrived
+ */
+typedef struct s_input_event
+{
+	int			type;
+	int			a;
+	int			b;
+	long long	us;
+}	t_input_event;
+
+/**
+ * @brief Single-producer single-consumer ring between the X callbacks,
+ * which advance head, and the simulation tick, which advances tail;
+ * batch_us is when the oldest event of the last drained batch arrived,
+ * until the frame showing it is presented
+ */
+typedef struct s_input_ring
+{
+	t_input_event	events[INPUT_RING_SIZE];
+	unsigned int	head;
+	unsigned int	tail;
+	unsigned long	dropped;
+	unsigned long	count;
+	unsigned long	batches;
+	unsigned long	presented;
+	long long		batch_us;
+	long long		latency_sum;
+	long long		latency_max;
+}	t_input_ring;
+
+# define SESSION_BUFFER	256	/* Entries written per --record flush */
+
+/**
+ * @brief One entry of a --record file: an event drained on tick, or with
+ * type INPUT_TICK the end of that tick, a and b holding the low and high
+ * halves of the pose checksum
+ */
+typedef struct s_rec_entry
+{
+	uint32_t	tick;
+	int32_t		type;
+	int32_t		a;
+	int32_t		b;
+}	t_rec_entry;
+
+/**
+ * @brief --record / --replay state: the file, the tick being simulated,
+ * the replayed entries and cursor into them, or the entries waiting to be
+ * written; diverged is one past the first tick whose pose did not match.
+ * A replay times the frames it presents in frame_sum and frame_max.
+ */
+typedef struct s_session
+{
+	int				mode;
+	int				fd;
+	const char		*path;
+	uint32_t		tick;
+	uint32_t		events;
+	uint64_t		start;
+	t_rec_entry		*entries;
+	size_t			count;
+	size_t			cursor;
+	t_rec_entry		buffer[SESSION_BUFFER];
+	int				buffered;
+	uint32_t		diverged;
+	uint32_t		frames;
+	long long		last_us;
+	long long		frame_sum;
+	long long		frame_max;
+}	t_session;
+
+# define POSE_FRESH	4	/* Set in t_simulation.middle until it is taken */
+
+/**
+ * @brief The player as one simulation tick left it, all the renderer
+ * reads; input_us is the oldest event in it not yet on screen, 0 if none
+ */
+typedef struct s_pose
+{
+	double		pos_x;
+	double		pos_y;
+	double		dir_x;
+	double		dir_y;
+	double		plane_x;
+	double		plane_y;
+	long long	input_us;
+}	t_pose;
+
+/**
+ * @brief Simulation thread and the triple buffer it publishes poses
+ * through: it fills slots[back] and swaps it into middle, the renderer
+ * swaps middle into front when POSE_FRESH is set. Neither side waits on
+ * the other; carry_us keeps the input time of a pose never taken.
+ */
+typedef struct s_simulation
+{
+	t_pose			slots[3];
+	unsigned int	middle;
+	unsigned int	back;
+	unsigned int	front;
+	long long		carry_us;
+	int				running;
+	int				started;
+	pthread_t		thread;
+}	t_simulation;
+
 /**
  * @brief Main game structure - orchestrates all subsystems
  */
@@ -139,6 +412,12 @@ typedef struct s_game
 	t_ray			ray;
 	t_wall			wall;
 	t_textures		textures;
+	long long		start_us;
+	t_startup		startup;
+	t_input_ring	input;
+	t_session		session;
+	t_simulation	sim;
+	t_pose			view;
 }	t_game;
 
 /* ************************************************************************** */
@@ -0,0 +1,38 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   alloc_wrap.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_bonus/cub3d.h"
+
+/**
+ * @brief Counting malloc and calloc, linked in with -Wl,--wrap so every call
+ * from cub3D, libft and a static MLX lands here first
+ */
+
+void	*__wrap_malloc(size_t size)
+{
+	t_alloc_count	*c;
+
+	c = alloc_counter();
+	__atomic_fetch_add(&c->count, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&c->bytes, size, __ATOMIC_RELAXED);
+	return (__real_malloc(size));
+}
+
+void	*__wrap_calloc(size_t count, size_t size)
+{
+	t_alloc_count	*c;
+
+	c = alloc_counter();
+	__atomic_fetch_add(&c->count, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&c->bytes, count * size, __ATOMIC_RELAXED);
+	return (__real_calloc(count, size));
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_validation.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_bonus/cub3d.h"
+
+/**
+ * @brief Load a .cubc, which validates its grid as it loads, or parse
+ * and validate a text map
+ */
+
+static void	parse_batch_map(t_game *game, int fd)
+{
+	if (load_compiled_map(game, fd))
+		return ;
+	read_and_parse_map_file(fd, game);
+	normalize_map_dimensions(game);
+	validate_parsed_map(game);
+}
+
+/**
+ * @brief Parse and validate with map.bail armed, so parse errors land
+ * back here instead of exiting
+ *
+ * Only pointers that do not change after setjmp are used once it returns
+ * a second time. A parse stopped mid-file leaves get_next_line holding a
+ * buffer for fd, which is released here before the caller closes fd.
+ */
+
+static int	guarded_parse(t_game *game, int fd)
+{
+	jmp_buf	bail;
+
+	game->map.bail = &bail;
+	if (setjmp(bail))
+	{
+		get_next_line_release(fd);
+		return (0);
+	}
+	parse_batch_map(game, fd);
+	game->map.bail = NULL;
+	return (1);
+}
+
+static void	validate_one_map(char *path, t_batch_result *result, int threads)
+{
+	t_game	game;
+	int		fd;
+
+	result->error = ERR_FILE_EXT;
+	if (!has_file_extension(path, ".cub")
+		&& !has_file_extension(path, ".cubc"))
+		return ;
+	result->error = ERR_FILE_OPEN;
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return ;
+	result->error = NULL;
+	init_game_structure(&game);
+	game.map.threads = threads;
+	if (guarded_parse(&game, fd))
+	{
+		result->width = game.map.width;
+		result->height = game.map.height;
+		cleanup_parsing_error(&game);
+	}
+	else
+		result->error = game.map.error;
+	close(fd);
+}
+
+/**
+ * @brief Take the next unclaimed file until the queue is empty
+ */
+
+static void	*batch_worker(void *arg)
+{
+	t_batch		*batch;
+	int			index;
+	long long	start;
+
+	batch = arg;
+	while (1)
+	{
+		pthread_mutex_lock(&batch->lock);
+		index = batch->next++;
+		pthread_mutex_unlock(&batch->lock);
+		if (index >= batch->count)
+			return (NULL);
+		start = get_time_us();
+		validate_one_map(batch->files[index], &batch->results[index],
+			batch->map_threads);
+		batch->results[index].elapsed_us = get_time_us() - start;
+	}
+}
+
+/**
+ * @brief Parse and validate every file on a pool sized by an optional
+ * leading --map-threads=<n>, without starting MLX
+ *
+ * The calling thread is one of the workers, so a failed pthread_create
+ * only shrinks the pool. Threads the pool cannot use, when there are
+ * fewer maps than threads, validate each map in bands instead.
+ * @return 0 if every map is valid, 1 otherwise
+ */
+
+int	run_batch_validation(int count, char **files)
+{
+	t_batch		batch;
+	pthread_t	workers[MAP_MAX_THREADS];
+	int			started;
+	long long	start;
+	int			failed;
+
+	if (!parse_batch_threads(&batch, &count, &files) || count < 1)
+		return (printf("Error\nUsage: --validate [--map-threads=<n>] "
+				"<map_file.cub>...\n"), 1);
+	batch.results = ft_calloc(count, sizeof(t_batch_result));
+	if (!batch.results || pthread_mutex_init(&batch.lock, NULL))
+		return (free(batch.results), printf("Error\n%s\n", ERR_MALLOC), 1);
+	batch.next = 0;
+	start = get_time_us();
+	started = 0;
+	while (started < batch.workers - 1
+		&& !pthread_create(&workers[started], NULL, batch_worker, &batch))
+		started++;
+	batch_worker(&batch);
+	while (started-- > 0)
+		pthread_join(workers[started], NULL);
+	failed = print_batch_report(&batch, get_time_us() - start);
+	return (pthread_mutex_destroy(&batch.lock), free(batch.results),
+		failed != 0);
+}
@@ -21,18 +21,6 @@ static void	destroy_single_texture(void *mlx_instance, void **texture_ptr)
 	}
 }
 
-static void	destroy_directional_textures(t_game *game)
-{
-	destroy_single_texture(game->mlx.instance,
-		(void **)&game->textures.north.mlx_ptr);
-	destroy_single_texture(game->mlx.instance,
-		(void **)&game->textures.south.mlx_ptr);
-	destroy_single_texture(game->mlx.instance,
-		(void **)&game->textures.east.mlx_ptr);
-	destroy_single_texture(game->mlx.instance,
-		(void **)&game->textures.west.mlx_ptr);
-}
-
 static void	destroy_screen_textures(t_game *game)
 {
 	destroy_single_texture(game->mlx.instance,
@@ -45,7 +33,7 @@ void	destroy_mlx_images(t_game *game)
 {
 	if (!game->mlx.instance)
 		return ;
-	destroy_directional_textures(game);
+	release_texture_entries(game);
 	destroy_screen_textures(game);
 }
 
@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   collision.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief First contact with the face of s->cell whose outward normal is
+ * sign along axis: the face plane pushed out by the radius, hit only
+ * while the centre is in front of it and moving towards it
+ */
+
+static void	sweep_face(t_sweep *s, int axis, double sign)
+{
+	double	plane;
+	double	t;
+	double	across;
+
+	plane = s->cell[axis] - s->r;
+	if (sign > 0.0)
+		plane = s->cell[axis] + 1.0 + s->r;
+	if (sign * s->d[axis] >= 0.0
+		|| sign * (s->p[axis] - plane) < -COLLISION_EPSILON)
+		return ;
+	t = (plane - s->p[axis]) / s->d[axis];
+	if (t < 0.0)
+		t = 0.0;
+	across = s->p[!axis] + t * s->d[!axis];
+	if (t >= s->t || across < s->cell[!axis]
+		|| across > s->cell[!axis] + 1.0)
+		return ;
+	s->t = t;
+	s->n[axis] = sign;
+	s->n[!axis] = 0.0;
+	s->hit = 1;
+}
+
+/**
+ * @brief First contact with a convex wall corner: the centre ray against
+ * a circle of the player's radius around the corner point
+ */
+
+static void	sweep_corner(t_sweep *s, double cx, double cy)
+{
+	double	m[2];
+	double	b;
+	double	c;
+	double	disc;
+	double	t;
+
+	m[0] = s->p[0] - cx;
+	m[1] = s->p[1] - cy;
+	b = m[0] * s->d[0] + m[1] * s->d[1];
+	c = m[0] * m[0] + m[1] * m[1] - s->r * s->r;
+	disc = b * b - s->len2 * c;
+	if (b >= 0.0 || disc < 0.0)
+		return ;
+	t = fmax(0.0, (-b - sqrt(disc)) / s->len2);
+	if (t >= s->t)
+		return ;
+	m[0] += t * s->d[0];
+	m[1] += t * s->d[1];
+	c = sqrt(m[0] * m[0] + m[1] * m[1]);
+	if (c <= 0.0)
+		return ;
+	s->t = t;
+	s->n[0] = m[0] / c;
+	s->n[1] = m[1] / c;
+	s->hit = 2;
+}
+
+/**
+ * @brief Sweep against one wall cell, skipping the faces shared with a
+ * neighbouring wall and the corners that are not convex, so sliding
+ * along a straight run of walls never catches on the seams
+ */
+
+static void	sweep_cell(t_sweep *s, t_map *map)
+{
+	int	open[4];
+
+	open[0] = !is_wall_cell(map, s->cell[0] - 1, s->cell[1]);
+	open[1] = !is_wall_cell(map, s->cell[0] + 1, s->cell[1]);
+	open[2] = !is_wall_cell(map, s->cell[0], s->cell[1] - 1);
+	open[3] = !is_wall_cell(map, s->cell[0], s->cell[1] + 1);
+	if (open[0])
+		sweep_face(s, 0, -1.0);
+	if (open[1])
+		sweep_face(s, 0, 1.0);
+	if (open[2])
+		sweep_face(s, 1, -1.0);
+	if (open[3])
+		sweep_face(s, 1, 1.0);
+	if (open[0] && open[2])
+		sweep_corner(s, s->cell[0], s->cell[1]);
+	if (open[1] && open[2])
+		sweep_corner(s, s->cell[0] + 1.0, s->cell[1]);
+	if (open[0] && open[3])
+		sweep_corner(s, s->cell[0], s->cell[1] + 1.0);
+	if (open[1] && open[3])
+		sweep_corner(s, s->cell[0] + 1.0, s->cell[1] + 1.0);
+}
+
+/**
+ * @brief True when the cell can meet the swept circle: its centre lies
+ * within radius + half a diagonal of the movement segment
+ */
+
+static int	is_cell_near_sweep(t_sweep *s, int x, int y)
+{
+	double	m[2];
+	double	t;
+	double	reach;
+
+	m[0] = x + 0.5 - s->p[0];
+	m[1] = y + 0.5 - s->p[1];
+	t = 0.0;
+	if (s->len2 > 0.0)
+		t = (m[0] * s->d[0] + m[1] * s->d[1]) / s->len2;
+	if (t < 0.0)
+		t = 0.0;
+	if (t > 1.0)
+		t = 1.0;
+	m[0] -= t * s->d[0];
+	m[1] -= t * s->d[1];
+	reach = s->r + CELL_HALF_DIAGONAL;
+	return (m[0] * m[0] + m[1] * m[1] <= reach * reach);
+}
+
+/**
+ * @brief Earliest contact of the circle moving from s->p by s->d with
+ * any wall cell its swept volume touches; s->t stays 1 without a hit
+ */
+
+void	sweep_wall_grid(t_sweep *s, t_map *map)
+{
+	int	lo[2];
+	int	hi[2];
+
+	lo[0] = (int)floor(fmin(s->p[0], s->p[0] + s->d[0]) - s->r);
+	lo[1] = (int)floor(fmin(s->p[1], s->p[1] + s->d[1]) - s->r);
+	hi[0] = (int)floor(fmax(s->p[0], s->p[0] + s->d[0]) + s->r);
+	hi[1] = (int)floor(fmax(s->p[1], s->p[1] + s->d[1]) + s->r);
+	s->len2 = s->d[0] * s->d[0] + s->d[1] * s->d[1];
+	s->t = 1.0;
+	s->hit = 0;
+	s->cell[1] = lo[1] - 1;
+	while (++s->cell[1] <= hi[1])
+	{
+		s->cell[0] = lo[0] - 1;
+		while (++s->cell[0] <= hi[0])
+		{
+			if (is_wall_cell(map, s->cell[0], s->cell[1])
+				&& is_cell_near_sweep(s, s->cell[0], s->cell[1]))
+				sweep_cell(s, map);
+		}
+	}
+}
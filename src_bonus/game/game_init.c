@@ -50,26 +50,32 @@ void	init_game_settings(t_game *game)
 	}
 }
 
-static void	load_texture_image(t_game *game, t_image *texture)
+/**
+ * @brief Tie each face to its texture's cache entry and check each file's
+ * header; nothing is decoded until a wall column first shows it
+ */
+
+static void	bind_wall_textures(t_game *game)
 {
-	if (!texture->path)
-		return ;
-	texture->mlx_ptr = mlx_xpm_file_to_image(game->mlx.instance,
-			texture->path, &texture->width, &texture->height);
-	if (!texture->mlx_ptr)
-		handle_game_error(game, "Error\nFailed to load texture file\n");
-	texture->data = mlx_get_data_addr(texture->mlx_ptr,
-			&texture->bits_per_pixel, &texture->line_length, &texture->endian);
-	if (!texture->data)
-		handle_game_error(game, "Error\nFailed to get texture data address\n");
+	t_textures	*t;
+	int			i;
+
+	t = &game->textures;
+	if (pthread_mutex_init(&t->lock, NULL) != 0)
+		handle_game_error(game, "Error\nFailed to create texture lock\n");
+	t->lock_ready = 1;
+	t->face[NORTH] = find_texture_entry(game, t->north.path);
+	t->face[SOUTH] = find_texture_entry(game, t->south.path);
+	t->face[EAST] = find_texture_entry(game, t->east.path);
+	t->face[WEST] = find_texture_entry(game, t->west.path);
+	i = -1;
+	while (++i < t->cache_count)
+		if (!probe_texture_file(&t->cache[i]))
+			handle_game_error(game, "Error\nFailed to load texture file\n");
 }
 
 void	init_mlx_images(t_game *game)
 {
-	load_texture_image(game, &game->textures.north);
-	load_texture_image(game, &game->textures.south);
-	load_texture_image(game, &game->textures.east);
-	load_texture_image(game, &game->textures.west);
 	game->textures.screen.mlx_ptr = mlx_new_image(game->mlx.instance,
 			game->mlx.width, game->mlx.height);
 	if (!game->textures.screen.mlx_ptr)
@@ -87,16 +93,22 @@ void	init_mlx_images(t_game *game)
 int	init_game_engine(t_game *game)
 {
 	init_game_settings(game);
+	bind_wall_textures(game);
 	game->mlx.instance = mlx_init();
 	if (!game->mlx.instance)
 		handle_game_error(game, "Error\nFailed to initialize MLX\n");
+	record_startup_phase(game, "mlx_init");
 	game->mlx.window = mlx_new_window(game->mlx.instance,
 			game->mlx.width, game->mlx.height, "cub3D");
 	if (!game->mlx.window)
 		handle_game_error(game, "Error\nFailed to create game window\n");
+	record_startup_phase(game, "window");
 	init_mlx_images(game);
 	init_player_input(game);
+	start_simulation(game);
+	record_startup_phase(game, "images");
 	init_minimap_system(game);
+	record_startup_phase(game, "minimap");
 	mlx_loop_hook(game->mlx.instance, &render_frame, game);
 	mlx_hook(game->mlx.window, 2, 1L << 0, handle_key_press, game);
 	mlx_hook(game->mlx.window, 3, 1L << 1, handle_key_release, game);
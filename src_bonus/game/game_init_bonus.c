@@ -12,15 +12,47 @@
 
 #include "../../includes_bonus/cub3d.h"
 
-void	init_minimap_system(t_game *game)
+static int	clamp_origin(int center, int visible, int total)
+{
+	int	origin;
+
+	origin = center - visible / 2;
+	if (origin > total - visible)
+		origin = total - visible;
+	if (origin < 0)
+		origin = 0;
+	return (origin);
+}
+
+/**
+ * @brief Scroll the minimap window so the player stays in its middle
+ */
+
+void	center_minimap_on_player(t_game *game)
 {
-	int	minimap_width;
-	int	minimap_height;
+	game->minimap.origin_x = clamp_origin((int)game->view.pos_x,
+			game->minimap.cols, game->map.width);
+	game->minimap.origin_y = clamp_origin((int)game->view.pos_y,
+			game->minimap.rows, game->map.height);
+}
+
+/**
+ * @brief Create the minimap image, capped at MINIMAP_MAX_CELLS per axis
+ * so its size stays fixed however large the map is
+ */
 
-	minimap_width = game->map.width * MINIMAP_SCALE;
-	minimap_height = game->map.height * MINIMAP_SCALE;
+void	init_minimap_system(t_game *game)
+{
+	game->minimap.cols = game->map.width;
+	if (game->minimap.cols > MINIMAP_MAX_CELLS)
+		game->minimap.cols = MINIMAP_MAX_CELLS;
+	game->minimap.rows = game->map.height;
+	if (game->minimap.rows > MINIMAP_MAX_CELLS)
+		game->minimap.rows = MINIMAP_MAX_CELLS;
+	game->textures.minimap.width = game->minimap.cols * MINIMAP_SCALE;
+	game->textures.minimap.height = game->minimap.rows * MINIMAP_SCALE;
 	game->textures.minimap.mlx_ptr = mlx_new_image(game->mlx.instance,
-			minimap_width, minimap_height);
+			game->textures.minimap.width, game->textures.minimap.height);
 	if (!game->textures.minimap.mlx_ptr)
 		handle_game_error(game, "Error\nFailed to create minimap\n");
 	game->textures.minimap.data
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_queue.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief Queue one event from an X callback; never blocks, so a full
+ * ring drops the event and counts it
+ */
+
+int	push_input_event(t_input_ring *ring, int type, int a, int b)
+{
+	unsigned int	head;
+	t_input_event	*event;
+
+	head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+	if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)
+		>= INPUT_RING_SIZE)
+	{
+		__atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+		return (0);
+	}
+	event = &ring->events[head & (INPUT_RING_SIZE - 1)];
+	event->type = type;
+	event->a = a;
+	event->b = b;
+	event->us = get_time_us();
+	__atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+	return (1);
+}
+
+static void	set_key_state(t_game *game, int keycode, int pressed)
+{
+	if (keycode == KEY_W)
+		game->player.key_w = pressed;
+	else if (keycode == KEY_S)
+		game->player.key_s = pressed;
+	else if (keycode == KEY_A)
+		game->player.key_a = pressed;
+	else if (keycode == KEY_D)
+		game->player.key_d = pressed;
+	else if (keycode == KEY_LEFT)
+		game->player.key_left = pressed;
+	else if (keycode == KEY_RIGHT)
+		game->player.key_right = pressed;
+}
+
+/**
+ * @brief Turn for a horizontal pointer move of dx pixels; pointer motion
+ * only ever adds multiplications, the one rotation comes at the tick
+ */
+
+static double	mouse_turn(t_game *game, int dx)
+{
+	double	turn;
+
+	turn = dx * game->player.mouse_sensitivity;
+	if (game->player.initial_dir != 'N' && game->player.initial_dir != 'S')
+		turn = -turn;
+	return (turn);
+}
+
+/**
+ * @brief Apply every queued event once per tick: keys update the held
+ * state and pointer deltas add up into the turn returned, so a burst of
+ * motion costs one rotation instead of one per event
+ */
+
+double	drain_input_events(t_game *game)
+{
+	t_input_ring	*ring;
+	t_input_event	*event;
+	unsigned int	head;
+	double			turn;
+
+	ring = &game->input;
+	head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+	turn = 0.0;
+	if (ring->tail != head && !ring->batch_us)
+		ring->batch_us = ring->events[ring->tail & (INPUT_RING_SIZE - 1)].us;
+	ring->batches += (ring->tail != head);
+	ring->count += head - ring->tail;
+	while (ring->tail != head)
+	{
+		event = &ring->events[ring->tail & (INPUT_RING_SIZE - 1)];
+		if (game->session.mode == SESSION_RECORD)
+			record_session_entry(game, event->type, event->a, event->b);
+		if (event->type == INPUT_MOTION)
+			turn += mouse_turn(game, event->a);
+		else
+			set_key_state(game, event->a, event->type == INPUT_KEY_PRESS);
+		__atomic_store_n(&ring->tail, ring->tail + 1, __ATOMIC_RELEASE);
+	}
+	return (turn);
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mouse_look.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+static int	is_far_from_center(t_game *game, int mouse_x, int mouse_y)
+{
+	return (abs(mouse_x - game->mlx.width / 2) > game->mlx.width / 4
+		|| abs(mouse_y - game->mlx.height / 2) > game->mlx.height / 4);
+}
+
+/**
+ * @brief Relative mouse-look: queue how far the pointer moved since the
+ * last event and keep it near the window centre
+ *
+ * The pointer is hidden on the first motion event and warped back to the
+ * centre whenever it strays a quarter of the window away, so it never
+ * stops at an edge. Only deltas are queued; the next tick turns their sum
+ * into one rotation.
+ */
+
+int	handle_mouse_rotation(int mouse_x, int mouse_y, t_game *game)
+{
+	t_pointer	*pointer;
+
+	pointer = &game->pointer;
+	if (!pointer->captured)
+	{
+		hide_pointer(game);
+		pointer->captured = 1;
+	}
+	else if (game->session.mode != SESSION_REPLAY
+		&& (mouse_x != pointer->last_x || mouse_y != pointer->last_y))
+		push_input_event(&game->input, INPUT_MOTION,
+			mouse_x - pointer->last_x, mouse_y - pointer->last_y);
+	pointer->last_x = mouse_x;
+	pointer->last_y = mouse_y;
+	if (is_far_from_center(game, mouse_x, mouse_y))
+	{
+		pointer->last_x = game->mlx.width / 2;
+		pointer->last_y = game->mlx.height / 2;
+		warp_pointer(game, pointer->last_x, pointer->last_y);
+	}
+	return (0);
+}
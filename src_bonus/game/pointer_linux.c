@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pointer_linux.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/*
+ * minilibx-linux takes the display and the window; pointer_macos.c has
+ * the macOS minilibx calls
+ */
+
+void	warp_pointer(t_game *game, int x, int y)
+{
+	mlx_mouse_move(game->mlx.instance, game->mlx.window, x, y);
+}
+
+void	hide_pointer(t_game *game)
+{
+	mlx_mouse_hide(game->mlx.instance, game->mlx.window);
+}
@@ -0,0 +1,29 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pointer_macos.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/*
+ * The macOS minilibx moves the pointer within a window and hides it
+ * globally; pointer_linux.c has the minilibx-linux calls
+ */
+
+void	warp_pointer(t_game *game, int x, int y)
+{
+	mlx_mouse_move(game->mlx.window, x, y);
+}
+
+void	hide_pointer(t_game *game)
+{
+	(void)game;
+	mlx_mouse_hide();
+}
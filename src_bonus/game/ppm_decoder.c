@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ppm_decoder.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief Skip whitespace and # comments between header fields
+ */
+
+static void	skip_ppm_space(const uint8_t *in, size_t size, size_t *p)
+{
+	while (*p < size && in[*p] && ft_strchr(" \t\n\v\f\r#", in[*p]))
+	{
+		if (in[*p] == '#')
+		{
+			while (*p < size && in[*p] != '\n')
+				(*p)++;
+		}
+		else
+			(*p)++;
+	}
+}
+
+/**
+ * @return The next decimal header field, or -1 if there is none
+ */
+
+static int	read_ppm_number(const uint8_t *in, size_t size, size_t *p)
+{
+	int	value;
+
+	skip_ppm_space(in, size, p);
+	if (*p >= size || !ft_isdigit(in[*p]))
+		return (-1);
+	value = 0;
+	while (*p < size && ft_isdigit(in[*p]) && value < 1000000)
+		value = value * 10 + (in[(*p)++] - '0');
+	return (value);
+}
+
+/**
+ * @brief Read one RGB sample triple (1 or 2 bytes each) as 0xRRGGBB,
+ * rescaling when the maximum value is not 255
+ */
+
+static uint32_t	read_ppm_pixel(const uint8_t *s, int bytes, int maxval)
+{
+	uint32_t	rgb;
+	int			value;
+	int			c;
+
+	if (bytes == 1 && maxval == 255)
+		return ((uint32_t)s[0] << 16 | (uint32_t)s[1] << 8 | s[2]);
+	rgb = 0;
+	c = -1;
+	while (++c < 3)
+	{
+		value = s[c * bytes];
+		if (bytes == 2)
+			value = value << 8 | s[c * 2 + 1];
+		if (value > maxval)
+			value = maxval;
+		rgb = rgb << 8 | (uint32_t)(value * 255 / maxval);
+	}
+	return (rgb);
+}
+
+/**
+ * @brief Read the P6 header into hdr (width, height, maximum value)
+ * @return The offset of the first sample, or 0 if the header is bad
+ */
+
+size_t	probe_ppm(const uint8_t *in, size_t size, int *hdr)
+{
+	size_t	p;
+	int		i;
+
+	if (size < 2 || in[0] != 'P' || in[1] != '6')
+		return (0);
+	p = 2;
+	i = -1;
+	while (++i < 3)
+		hdr[i] = read_ppm_number(in, size, &p);
+	if (hdr[0] < 1 || hdr[1] < 1 || hdr[0] > TEXTURE_MAX_SIDE
+		|| hdr[1] > TEXTURE_MAX_SIDE || hdr[2] < 1 || hdr[2] > 65535
+		|| p >= size || !in[p] || !ft_strchr(" \t\n\v\f\r", in[p]))
+		return (0);
+	return (p + 1);
+}
+
+/**
+ * @brief Decode a binary P6 PPM straight into the renderer's layout
+ * @return 1 with e->pixels, e->width and e->height set, 0 otherwise
+ */
+
+int	decode_ppm(const uint8_t *in, size_t size, t_tex_entry *e)
+{
+	size_t	p;
+	size_t	i;
+	int		hdr[3];
+	int		bytes;
+
+	p = probe_ppm(in, size, hdr);
+	if (!p)
+		return (0);
+	bytes = 1 + (hdr[2] > 255);
+	if (size - p < (size_t)hdr[0] * hdr[1] * 3 * bytes)
+		return (0);
+	e->pixels = malloc((size_t)hdr[0] * hdr[1] * sizeof(uint32_t));
+	i = -1;
+	while (e->pixels && ++i < (size_t)hdr[0] * hdr[1])
+		e->pixels[i] = read_ppm_pixel(in + p + i * 3 * bytes, bytes,
+				hdr[2]);
+	return (e->width = hdr[0], e->height = hdr[1], e->pixels != NULL);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   qoi_decoder.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief Check the 14-byte header and take the size from it; only the
+ * start of the file is needed
+ */
+
+int	probe_qoi(const uint8_t *in, size_t size, t_tex_entry *e)
+{
+	uint32_t	w;
+	uint32_t	h;
+
+	if (size < 22 || ft_memcmp(in, "qoif", 4) || in[12] < 3 || in[12] > 4)
+		return (0);
+	w = (uint32_t)in[4] << 24 | (uint32_t)in[5] << 16
+		| (uint32_t)in[6] << 8 | in[7];
+	h = (uint32_t)in[8] << 24 | (uint32_t)in[9] << 16
+		| (uint32_t)in[10] << 8 | in[11];
+	if (w < 1 || h < 1 || w > TEXTURE_MAX_SIDE || h > TEXTURE_MAX_SIDE)
+		return (0);
+	e->width = w;
+	e->height = h;
+	return (1);
+}
+
+static void	add_qoi_delta(t_qoi *q, int dr, int dg, int db)
+{
+	q->px.c[0] += dr;
+	q->px.c[1] += dg;
+	q->px.c[2] += db;
+}
+
+/**
+ * @brief Apply one QOI chunk other than a run to the current pixel
+ *
+ * The longest chunk is 5 bytes and the stream ends with 8 bytes of
+ * padding, so starting a chunk before that padding never reads past it.
+ */
+
+static void	read_qoi_chunk(const uint8_t *in, size_t *p, t_qoi *q)
+{
+	uint8_t	b;
+	int		vg;
+
+	b = in[(*p)++];
+	if (b == 0xfe || b == 0xff)
+	{
+		q->px.c[0] = in[(*p)++];
+		q->px.c[1] = in[(*p)++];
+		q->px.c[2] = in[(*p)++];
+		if (b == 0xff)
+			q->px.c[3] = in[(*p)++];
+	}
+	else if (b >> 6 == 0)
+		q->px = q->index[b];
+	else if (b >> 6 == 1)
+		add_qoi_delta(q, ((b >> 4) & 3) - 2, ((b >> 2) & 3) - 2,
+			(b & 3) - 2);
+	else if (b >> 6 == 2)
+	{
+		vg = (b & 0x3f) - 32;
+		b = in[(*p)++];
+		add_qoi_delta(q, vg - 8 + (b >> 4), vg, vg - 8 + (b & 15));
+	}
+}
+
+/**
+ * @brief Index the current pixel and return it as 0xRRGGBB; a fully
+ * transparent pixel becomes the value MLX uses for transparency
+ */
+
+static uint32_t	emit_qoi_pixel(t_qoi *q)
+{
+	q->index[(q->px.c[0] * 3 + q->px.c[1] * 5 + q->px.c[2] * 7
+			+ q->px.c[3] * 11) % 64] = q->px;
+	if (!q->px.c[3])
+		return (TEXTURE_TRANSPARENT);
+	return ((uint32_t)q->px.c[0] << 16 | q->px.c[1] << 8 | q->px.c[2]);
+}
+
+/**
+ * @brief Decode a QOI image straight into the renderer's pixel layout
+ * @return 1 with e->pixels, e->width and e->height set, 0 otherwise
+ */
+
+int	decode_qoi(const uint8_t *in, size_t size, t_tex_entry *e)
+{
+	t_qoi	q;
+	size_t	p;
+	size_t	i;
+
+	if (!probe_qoi(in, size, e))
+		return (0);
+	e->pixels = malloc((size_t)e->width * e->height * sizeof(uint32_t));
+	ft_bzero(&q, sizeof(q));
+	q.px.c[3] = 255;
+	p = 14;
+	i = 0;
+	while (e->pixels && i < (size_t)e->width * e->height
+		&& (q.run > 0 || p < size - 8))
+	{
+		if (q.run > 0)
+			q.run--;
+		else if (in[p] >= 0xc0 && in[p] < 0xfe)
+			q.run = in[p++] & 0x3f;
+		else
+			read_qoi_chunk(in, &p, &q);
+		e->pixels[i++] = emit_qoi_pixel(&q);
+	}
+	if (i == (size_t)e->width * e->height)
+		return (1);
+	return (free(e->pixels), e->pixels = NULL, 0);
+}
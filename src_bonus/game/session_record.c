@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   session_record.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief FNV-1a over the bits of the pose, so any drift shows up
+ */
+
+uint64_t	pose_checksum(t_player *player)
+{
+	double	pose[6];
+
+	pose[0] = player->pos_x;
+	pose[1] = player->pos_y;
+	pose[2] = player->dir_x;
+	pose[3] = player->dir_y;
+	pose[4] = player->plane_x;
+	pose[5] = player->plane_y;
+	return (cubc_hash(CUBC_HASH_SEED, pose, sizeof(pose)));
+}
+
+/**
+ * @brief Write the buffered entries; on a write error recording stops
+ * and the game goes on
+ */
+
+static void	flush_session(t_session *s)
+{
+	ssize_t	size;
+
+	size = sizeof(t_rec_entry) * s->buffered;
+	if (s->buffered && write(s->fd, s->buffer, size) != size)
+	{
+		printf("Error\nCannot write recording: %s\n", s->path);
+		close(s->fd);
+		s->mode = SESSION_OFF;
+	}
+	s->buffered = 0;
+}
+
+void	record_session_entry(t_game *game, int type, int a, int b)
+{
+	t_session	*s;
+
+	s = &game->session;
+	s->buffer[s->buffered].tick = s->tick;
+	s->buffer[s->buffered].type = type;
+	s->buffer[s->buffered].a = a;
+	s->buffer[s->buffered].b = b;
+	s->events += (type != INPUT_TICK);
+	if (++s->buffered == SESSION_BUFFER)
+		flush_session(s);
+}
+
+/**
+ * @brief Finish the header of a recording, or report how a replay went
+ */
+
+static void	print_replay_report(t_session *s)
+{
+	printf("Replay %s: %u ticks, %u events, ", s->path, s->tick, s->events);
+	if (s->diverged)
+		printf("pose diverged at tick %u", s->diverged - 1);
+	else
+		printf("every pose matched");
+	if (s->frames > 1)
+		printf(", %u frames, %.2f ms per frame mean, %.2f ms max", s->frames,
+			s->frame_sum / 1000.0 / (s->frames - 1), s->frame_max / 1000.0);
+	printf("\n");
+	free(s->entries);
+	s->entries = NULL;
+	s->mode = SESSION_OFF;
+}
+
+void	close_session(t_game *game)
+{
+	t_session		*s;
+	t_rec_header	h;
+
+	s = &game->session;
+	if (s->mode == SESSION_REPLAY)
+		print_replay_report(s);
+	if (s->mode != SESSION_RECORD)
+		return ;
+	flush_session(s);
+	if (s->mode != SESSION_RECORD)
+		return ;
+	ft_bzero(&h, sizeof(h));
+	h.magic = REC_MAGIC;
+	h.version = REC_VERSION;
+	h.ticks = s->tick;
+	h.events = s->events;
+	h.sensitivity = game->player.mouse_sensitivity;
+	h.start = s->start;
+	if (pwrite(s->fd, &h, sizeof(h), 0) != sizeof(h) || close(s->fd) < 0)
+		printf("Error\nCannot write recording: %s\n", s->path);
+	else
+		printf("Recorded %u ticks, %u events to %s\n", s->tick, s->events,
+			s->path);
+	s->mode = SESSION_OFF;
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   session_replay.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief Read a whole --record file; the entry count must agree with the
+ * file size so a truncated recording is refused before anything runs
+ */
+
+static int	load_replay(t_session *s, t_rec_header *h, int fd)
+{
+	struct stat	st;
+	size_t		size;
+
+	if (fstat(fd, &st) < 0 || read(fd, h, sizeof(*h)) != sizeof(*h)
+		|| h->magic != REC_MAGIC || h->version != REC_VERSION)
+		return (0);
+	s->count = (size_t)h->ticks + h->events;
+	size = s->count * sizeof(t_rec_entry);
+	if ((size_t)st.st_size != sizeof(*h) + size || !s->count)
+		return (0);
+	s->entries = malloc(size);
+	if (s->entries && read(fd, s->entries, size) == (ssize_t)size)
+	{
+		s->start = h->start;
+		return (1);
+	}
+	free(s->entries);
+	s->entries = NULL;
+	return (0);
+}
+
+/**
+ * @brief Open the file named by --record or --replay; a replay takes the
+ * pointer sensitivity it was recorded with
+ * @return 1, or 0 with a message when the file cannot be used
+ */
+
+int	open_session(t_game *game)
+{
+	t_session		*s;
+	t_rec_header	h;
+	int				ok;
+
+	s = &game->session;
+	if (s->mode == SESSION_RECORD)
+	{
+		s->fd = open(s->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		ok = (s->fd >= 0 && lseek(s->fd, sizeof(h), SEEK_SET) >= 0);
+	}
+	else if (s->mode == SESSION_REPLAY)
+	{
+		s->fd = open(s->path, O_RDONLY);
+		ok = (s->fd >= 0 && load_replay(s, &h, s->fd));
+		if (ok)
+			game->player.mouse_sensitivity = h.sensitivity;
+		if (s->fd >= 0)
+			close(s->fd);
+	}
+	else
+		return (1);
+	if (!ok)
+		printf("Error\nCannot use session file: %s\n", s->path);
+	return (ok);
+}
+
+/**
+ * @brief Start a tick: check the spawn pose once, then in a replay queue
+ * this tick's recorded events as if X had just delivered them
+ * @return 0 when the recording has run out and the simulation stops
+ */
+
+int	begin_session_tick(t_game *game)
+{
+	t_session	*s;
+	t_rec_entry	*e;
+
+	s = &game->session;
+	if (s->tick == 0 && s->mode == SESSION_RECORD)
+		s->start = pose_checksum(&game->player);
+	else if (s->tick == 0 && s->start != pose_checksum(&game->player))
+		s->diverged = 1;
+	if (s->mode != SESSION_REPLAY)
+		return (1);
+	if (s->cursor >= s->count)
+	{
+		__atomic_store_n(&game->sim.running, 0, __ATOMIC_RELEASE);
+		return (0);
+	}
+	while (s->cursor < s->count && s->entries[s->cursor].tick == s->tick
+		&& s->entries[s->cursor].type != INPUT_TICK)
+	{
+		e = &s->entries[s->cursor++];
+		s->events++;
+		push_input_event(&game->input, e->type, e->a, e->b);
+	}
+	return (1);
+}
+
+/**
+ * @brief Take the next recorded tick end and compare its checksum; the
+ * cursor always moves so a damaged recording still comes to an end
+ */
+
+static void	check_recorded_pose(t_session *s, uint64_t sum)
+{
+	t_rec_entry	*e;
+
+	if (s->cursor >= s->count)
+		return ;
+	e = &s->entries[s->cursor++];
+	if (!s->diverged && (e->tick != s->tick || e->type != INPUT_TICK
+			|| (uint32_t)e->a != (uint32_t)sum
+			|| (uint32_t)e->b != (uint32_t)(sum >> 32)))
+		s->diverged = s->tick + 1;
+}
+
+/**
+ * @brief End a tick: record the pose checksum, or in a replay compare it
+ * with the recorded one
+ */
+
+void	end_session_tick(t_game *game)
+{
+	t_session	*s;
+	uint64_t	sum;
+
+	s = &game->session;
+	sum = pose_checksum(&game->player);
+	if (s->mode == SESSION_RECORD)
+		record_session_entry(game, INPUT_TICK, (int32_t)(uint32_t)sum,
+			(int32_t)(uint32_t)(sum >> 32));
+	if (s->mode == SESSION_REPLAY)
+		check_recorded_pose(s, sum);
+	s->tick++;
+}
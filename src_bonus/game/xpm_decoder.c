@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   xpm_decoder.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief Return the next double-quoted string after *cursor, terminated
+ * in place, skipping C comments; NULL when none is left
+ */
+
+char	*next_xpm_string(char **cursor)
+{
+	char	*s;
+	char	*end;
+
+	s = *cursor;
+	while (*s && *s != '"')
+	{
+		if (s[0] == '/' && s[1] == '*')
+		{
+			s = ft_strnstr(s + 2, "*/", ft_strlen(s + 2));
+			if (!s)
+				return (NULL);
+			s++;
+		}
+		s++;
+	}
+	if (!*s)
+		return (NULL);
+	end = ft_strchr(s + 1, '"');
+	if (!end)
+		return (NULL);
+	*end = '\0';
+	*cursor = end + 1;
+	return (s + 1);
+}
+
+/**
+ * @brief Read the "c" value of a palette line as 0xRRGGBB, or as the
+ * transparent 0xFF000000 MLX uses for None; named colours are refused
+ */
+
+static int	parse_xpm_color(char *s, uint32_t *color)
+{
+	const char	*digits;
+	char		*hex;
+	int			i;
+
+	while (*s && !(s[0] == 'c' && (s[-1] == ' ' || s[-1] == '\t')
+			&& (s[1] == ' ' || s[1] == '\t')))
+		s++;
+	if (!*s)
+		return (0);
+	s += 2;
+	while (*s == ' ' || *s == '\t')
+		s++;
+	if (!ft_strncmp(s, "None", 4) || !ft_strncmp(s, "none", 4))
+		return (*color = TEXTURE_TRANSPARENT, 1);
+	digits = "0123456789abcdef";
+	*color = 0;
+	i = 0;
+	while (*s == '#' && ++i <= 6 && s[i])
+	{
+		hex = ft_strchr(digits, ft_tolower(s[i]));
+		if (!hex)
+			return (0);
+		*color = (*color << 4) | (uint32_t)(hex - digits);
+	}
+	return (*s == '#' && i == 7 && (!s[7] || s[7] == ' ' || s[7] == '\t'));
+}
+
+/**
+ * @brief Fill a table indexed by the one or two key characters
+ * @param hdr Width, height, colour count and characters per pixel
+ */
+
+static int	parse_xpm_palette(char **cursor, int *hdr, uint32_t *table)
+{
+	char	*line;
+	int		key;
+	int		i;
+
+	i = -1;
+	while (++i < 65536)
+		table[i] = XPM_NO_COLOR;
+	i = -1;
+	while (++i < hdr[2])
+	{
+		line = next_xpm_string(cursor);
+		if (!line || !line[0] || (hdr[3] == 2 && !line[1]))
+			return (0);
+		key = (unsigned char)line[0];
+		if (hdr[3] == 2)
+			key |= (unsigned char)line[1] << 8;
+		if (!parse_xpm_color(line + hdr[3], &table[key]))
+			return (0);
+	}
+	return (1);
+}
+
+static int	decode_xpm_pixels(char **cursor, int *hdr, uint32_t *table,
+		uint32_t *pixels)
+{
+	char	*line;
+	int		key;
+	int		x;
+	int		y;
+
+	y = -1;
+	while (++y < hdr[1])
+	{
+		line = next_xpm_string(cursor);
+		if (!line || ft_strlen(line) < (size_t)hdr[0] * hdr[3])
+			return (0);
+		x = -1;
+		while (++x < hdr[0])
+		{
+			key = (unsigned char)line[x * hdr[3]];
+			if (hdr[3] == 2)
+				key |= (unsigned char)line[x * 2 + 1] << 8;
+			if (table[key] == XPM_NO_COLOR)
+				return (0);
+			pixels[(size_t)y * hdr[0] + x] = table[key];
+		}
+	}
+	return (1);
+}
+
+/**
+ * @brief Decode an XPM file already read into buf (modified in place)
+ *
+ * Handles the one and two characters per pixel, #RRGGBB files the
+ * textures use; anything else returns 0 so MLX can decode it instead.
+ * The 256 KiB key table sits on the stack of the decoding thread.
+ * @return 1 with e->pixels, e->width and e->height set, 0 otherwise
+ */
+
+int	decode_xpm(char *buf, t_tex_entry *e)
+{
+	uint32_t	table[65536];
+	int			hdr[4];
+
+	if (!probe_xpm(&buf, hdr) || hdr[3] > 2)
+		return (0);
+	e->pixels = malloc((size_t)hdr[0] * hdr[1] * sizeof(uint32_t));
+	if (e->pixels && parse_xpm_palette(&buf, hdr, table)
+		&& decode_xpm_pixels(&buf, hdr, table, e->pixels))
+		return (e->width = hdr[0], e->height = hdr[1], 1);
+	free(e->pixels);
+	e->pixels = NULL;
+	return (0);
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   launch_options.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_bonus/cub3d.h"
+
+/**
+ * @brief Read a decimal like 2.5 as thousandths: --mouse-sensitivity is
+ * given in milliradians per pixel
+ */
+
+static int	parse_milli(const char *s, double *value)
+{
+	double	scale;
+	int		i;
+
+	*value = 0.0;
+	scale = 1.0;
+	i = 0;
+	while (ft_isdigit(s[i]))
+		*value = *value * 10.0 + (s[i++] - '0');
+	if (s[i] == '.' && i > 0)
+	{
+		while (ft_isdigit(s[++i]))
+		{
+			scale /= 10.0;
+			*value += (s[i] - '0') * scale;
+		}
+	}
+	*value /= 1000.0;
+	return (i > 0 && !s[i]);
+}
+
+/**
+ * @brief --record=<file> logs every tick's input, --replay=<file> plays
+ * such a log back instead of live input
+ */
+
+static int	apply_session_option(t_game *game, char *arg)
+{
+	if (!ft_strncmp(arg, "--record=", 9) && arg[9])
+		game->session.mode = SESSION_RECORD;
+	else if (!ft_strncmp(arg, "--replay=", 9) && arg[9])
+		game->session.mode = SESSION_REPLAY;
+	else
+		return (0);
+	game->session.path = arg + 9;
+	return (1);
+}
+
+/**
+ * @brief Apply one launcher option
+ * @return 1 if arg was an option, 0 if it should be read as the map path,
+ * -1 if it was an option with a bad value
+ */
+
+static int	apply_launch_option(t_game *game, char *arg)
+{
+	int	status;
+
+	if (apply_session_option(game, arg))
+		return (1);
+	status = apply_tuning_option(game, arg);
+	if (status)
+		return (status);
+	if (!ft_strcmp(arg, "--no-texture-cache"))
+		game->textures.disk_cache = 0;
+	else if (!ft_strcmp(arg, "--startup-report"))
+		start_startup_report(game);
+	else if (!ft_strncmp(arg, "--mouse-sensitivity=", 20))
+		return (parse_milli(arg + 20, &game->player.mouse_sensitivity) * 2 - 1);
+	else
+		return (0);
+	return (1);
+}
+
+/**
+ * @brief Consume the options placed before the map path
+ *
+ * argv is shifted past them so the rest of the launcher still finds the
+ * map in argv[1]; anything unknown is left there and rejected as a path.
+ * @return 1, or 0 when an option is invalid
+ */
+
+int	parse_launch_options(t_game *game, int *argc, char ***argv)
+{
+	char	*program;
+	int		status;
+
+	program = (*argv)[0];
+	status = 1;
+	while (*argc > 2 && status > 0)
+	{
+		status = apply_launch_option(game, (*argv)[1]);
+		if (status > 0)
+		{
+			(*argv)++;
+			(*argc)--;
+		}
+	}
+	(*argv)[0] = program;
+	if (status < 0)
+		printf("Error\nInvalid option value: %s\n", (*argv)[1]);
+	return (status >= 0);
+}
@@ -14,8 +14,12 @@
 
 int	clean_exit_program(t_game *game)
 {
+	stop_simulation(game);
+	print_input_report(game);
+	close_session(game);
 	free_texture_paths(game);
-	free_string_array(game->map.grid);
+	free_map_grid(&game->map);
+	free_map_acceleration(&game->map);
 	free_parsing_buffers(game);
 	destroy_mlx_images(game);
 	cleanup_mlx_resources(game);
@@ -25,7 +29,10 @@ int	clean_exit_program(t_game *game)
 
 void	cleanup_parsing_error(t_game *game)
 {
-	free_string_array(game->map.grid);
+	stop_simulation(game);
+	close_session(game);
+	free_map_grid(&game->map);
+	free_map_acceleration(&game->map);
 	free_parsing_buffers(game);
 	free_texture_paths(game);
 }
@@ -39,9 +46,12 @@ void	cleanup_initialization_error(t_game *game)
 
 void	handle_game_error(t_game *game, char *error_message)
 {
+	stop_simulation(game);
 	printf("%s", error_message);
+	close_session(game);
 	free_texture_paths(game);
-	free_string_array(game->map.grid);
+	free_map_grid(&game->map);
+	free_map_acceleration(&game->map);
 	destroy_mlx_images(game);
 	if (game->mlx.window && game->mlx.instance)
 		mlx_destroy_window(game->mlx.instance, game->mlx.window);
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+static size_t	arena_header_size(void)
+{
+	return ((sizeof(t_arena_block) + 15) & ~(size_t)15);
+}
+
+/**
+ * @brief Bump-allocate size bytes (16-byte aligned) from the arena
+ *
+ * Memory is only given back all at once by arena_release, so parse-time
+ * temporaries cost one malloc per ARENA_BLOCK_SIZE instead of one each.
+ */
+
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+	size_t			capacity;
+
+	size = (size + 15) & ~(size_t)15;
+	if (!arena->head || arena->head->used + size > arena->head->size)
+	{
+		capacity = ARENA_BLOCK_SIZE;
+		if (size > capacity)
+			capacity = size;
+		block = malloc(arena_header_size() + capacity);
+		if (!block)
+			return (NULL);
+		block->next = arena->head;
+		block->used = 0;
+		block->size = capacity;
+		arena->head = block;
+	}
+	block = arena->head;
+	block->used += size;
+	return ((char *)block + arena_header_size() + block->used - size);
+}
+
+char	*arena_strndup(t_arena *arena, const char *src, size_t len)
+{
+	char	*copy;
+
+	copy = arena_alloc(arena, len + 1);
+	if (!copy)
+		return (NULL);
+	ft_memcpy(copy, src, len);
+	copy[len] = '\0';
+	return (copy);
+}
+
+void	arena_release(t_arena *arena)
+{
+	t_arena_block	*next;
+
+	while (arena->head)
+	{
+		next = arena->head->next;
+		free(arena->head);
+		arena->head = next;
+	}
+}
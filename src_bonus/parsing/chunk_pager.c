@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   chunk_pager.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief Background thread keeping the chunks around the player resident
+ *
+ * It sleeps until the main thread publishes a new target, reads ahead the
+ * window the player is heading into, then the window they stand in, and
+ * trims everything else back to the budget.
+ */
+
+static void	*chunk_pager_main(void *arg)
+{
+	t_map			*map;
+	unsigned int	seen;
+	int				target[4];
+
+	map = arg;
+	seen = 0;
+	pthread_mutex_lock(&map->pager.lock);
+	while (!map->pager.stop)
+	{
+		if (seen == map->pager.generation)
+			pthread_cond_wait(&map->pager.wake, &map->pager.lock);
+		else
+		{
+			seen = map->pager.generation;
+			ft_memcpy(target, map->pager.target, sizeof(target));
+			pthread_mutex_unlock(&map->pager.lock);
+			admit_chunk_window(map, target[2], target[3]);
+			admit_chunk_window(map, target[0], target[1]);
+			trim_chunk_pages(map);
+			pthread_mutex_lock(&map->pager.lock);
+		}
+	}
+	pthread_mutex_unlock(&map->pager.lock);
+	return (NULL);
+}
+
+static int	init_pager_state(t_map *map, double x, double y)
+{
+	t_pager	*p;
+	size_t	chunks;
+	size_t	window;
+
+	p = &map->pager;
+	chunks = (size_t)map->macros_w * map->macros_h;
+	p->prev = malloc(chunks * sizeof(int));
+	p->next = malloc(chunks * sizeof(int));
+	p->admitted = ft_calloc(chunks, 1);
+	window = (2 * MAP_CHUNK_RADIUS + 1) * (2 * MAP_CHUNK_RADIUS + 1);
+	p->budget = map->chunk_budget / (CHUNK_BYTES + CHUNK_BITS_BYTES);
+	if (p->budget < 2 * window)
+		p->budget = 2 * window;
+	p->head = -1;
+	p->tail = -1;
+	p->target[0] = (int)x >> 6;
+	p->target[1] = (int)y >> 6;
+	p->target[2] = p->target[0];
+	p->target[3] = p->target[1];
+	p->last_pos[0] = x;
+	p->last_pos[1] = y;
+	p->generation = 1;
+	return (p->prev && p->next && p->admitted);
+}
+
+/**
+ * @brief Start paging a compiled map; text maps live on the heap and are
+ * left alone. Without a thread the map still works, just fully demand paged
+ */
+
+void	start_chunk_pager(t_map *map, double x, double y)
+{
+	t_pager	*p;
+
+	p = &map->pager;
+	if (!map->compiled || !init_pager_state(map, x, y))
+	{
+		stop_chunk_pager(map);
+		return ;
+	}
+	if (pthread_mutex_init(&p->lock, NULL) == 0)
+	{
+		if (pthread_cond_init(&p->wake, NULL) == 0)
+		{
+			if (pthread_create(&p->thread, NULL, chunk_pager_main, map) == 0)
+			{
+				p->running = 1;
+				return ;
+			}
+			pthread_cond_destroy(&p->wake);
+		}
+		pthread_mutex_destroy(&p->lock);
+	}
+	stop_chunk_pager(map);
+}
+
+void	stop_chunk_pager(t_map *map)
+{
+	t_pager	*p;
+
+	p = &map->pager;
+	if (p->running)
+	{
+		pthread_mutex_lock(&p->lock);
+		p->stop = 1;
+		pthread_cond_signal(&p->wake);
+		pthread_mutex_unlock(&p->lock);
+		pthread_join(p->thread, NULL);
+		pthread_mutex_destroy(&p->lock);
+		pthread_cond_destroy(&p->wake);
+		p->running = 0;
+	}
+	free(p->prev);
+	free(p->next);
+	free(p->admitted);
+	p->prev = NULL;
+	p->next = NULL;
+	p->admitted = NULL;
+}
+
+/**
+ * @brief Publish the chunk under the player and the one MAP_PREFETCH_CHUNKS
+ * ahead along their movement. A tiny share of the view direction keeps
+ * the heading defined while standing still without bending a real step.
+ *
+ * Called once per frame; the pager is only woken when a target changes.
+ */
+
+void	update_chunk_pager(t_game *game)
+{
+	t_pager	*p;
+	double	d[3];
+	int		target[4];
+
+	p = &game->map.pager;
+	if (!p->running)
+		return ;
+	d[0] = game->view.pos_x - p->last_pos[0] + game->view.dir_x * 1e-6;
+	d[1] = game->view.pos_y - p->last_pos[1] + game->view.dir_y * 1e-6;
+	d[2] = MAP_PREFETCH_CHUNKS * 64 / sqrt(d[0] * d[0] + d[1] * d[1]);
+	p->last_pos[0] = game->view.pos_x;
+	p->last_pos[1] = game->view.pos_y;
+	target[0] = (int)game->view.pos_x >> 6;
+	target[1] = (int)game->view.pos_y >> 6;
+	target[2] = (int)floor(game->view.pos_x + d[0] * d[2]) >> 6;
+	target[3] = (int)floor(game->view.pos_y + d[1] * d[2]) >> 6;
+	if (!ft_memcmp(target, p->target, sizeof(target)))
+		return ;
+	pthread_mutex_lock(&p->lock);
+	ft_memcpy(p->target, target, sizeof(target));
+	p->generation++;
+	pthread_cond_signal(&p->wake);
+	pthread_mutex_unlock(&p->lock);
+}
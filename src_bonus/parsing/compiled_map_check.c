@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compiled_map_check.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief Words in a gathered row: every chunk of the row plus one guard
+ * word of spaces past the end
+ */
+
+int	compiled_row_words(int width)
+{
+	return ((((width + 63) >> 6) << 3) + 1);
+}
+
+/**
+ * @brief Row y in a ring of three 64-row bands; rows outside the map all
+ * share the record after the ring, whose mask is all space
+ */
+
+static char	*band_row(t_map *map, char *rows, size_t stride, int y)
+{
+	if (y < 0 || y >= map->height)
+		return (rows + 3 * 64 * 2 * stride);
+	return (rows + ((y >> 6) % 3 * 64 + (y & 63)) * 2 * stride);
+}
+
+/**
+ * @brief Check every row, gathering each chunk row a band ahead so the
+ * rows above and below are always at hand
+ */
+
+static void	scan_compiled_rows(t_map *map, char *rows, size_t stride,
+		t_band *band)
+{
+	uint64_t	*space[3];
+	int			y;
+
+	load_compiled_band(map, 0, rows, 1);
+	y = -1;
+	while (++y < map->height)
+	{
+		if ((y & 63) == 0 && y + 64 < map->height)
+			load_compiled_band(map, (y >> 6) + 1,
+				band_row(map, rows, stride, y + 64), 1);
+		space[0] = (uint64_t *)(band_row(map, rows, stride, y - 1) + stride);
+		space[1] = (uint64_t *)(band_row(map, rows, stride, y) + stride);
+		space[2] = (uint64_t *)(band_row(map, rows, stride, y + 1) + stride);
+		band->first = y;
+		check_compiled_row(band_row(map, rows, stride, y), space, band);
+	}
+}
+
+/**
+ * @brief Flood fill from the spawn, for maps whose rows are not closed
+ * on their own, as validate_open_walls does for a text map
+ * @return 1 if closed, 0 if not, -1 if out of memory
+ */
+
+static int	flood_compiled_grid(t_map *map, char *rows, t_cubc_header *h)
+{
+	uint8_t	*cells;
+	size_t	stride;
+	int		closed;
+	int		x;
+	int		y;
+
+	cells = malloc((size_t)map->width * map->height);
+	if (!cells)
+		return (-1);
+	stride = (size_t)compiled_row_words(map->width) * 8;
+	y = -1;
+	while (++y < map->height)
+	{
+		if ((y & 63) == 0)
+			load_compiled_band(map, y >> 6, rows, 0);
+		x = -1;
+		while (++x < map->width)
+			cells[(size_t)y * map->width + x]
+				= (rows[(y & 63) * 2 * stride + x] == '1');
+	}
+	closed = flood_fill(map, cells, h->player_x, h->player_y);
+	free(cells);
+	return (closed);
+}
+
+/**
+ * @brief Validate a compiled grid again instead of trusting the
+ * CUBC_VALIDATED flag: only valid characters, exactly one player where
+ * the header says, and the same closure rule as a text map
+ */
+
+void	check_compiled_grid(t_game *game, t_cubc_header *h)
+{
+	t_band	band;
+	char	*rows;
+	size_t	stride;
+	int		ok;
+
+	stride = (size_t)compiled_row_words(game->map.width) * 8;
+	rows = malloc(stride * 2 * (3 * 64 + 1));
+	if (!rows)
+		handle_parsing_error(game, ERR_MALLOC);
+	ft_memset(rows + (3 * 64 * 2 + 1) * stride, 0x80, stride);
+	ft_bzero(&band, sizeof(band));
+	band.map = &game->map;
+	band.closed = 1;
+	scan_compiled_rows(&game->map, rows, stride, &band);
+	ok = (band.players == 1 && band.player_dir == h->player_dir
+			&& band.player_col == (int)h->player_x
+			&& band.player_row == (int)h->player_y);
+	if (ok && !band.closed)
+		ok = flood_compiled_grid(&game->map, rows, h);
+	free(rows);
+	if (ok < 0)
+		handle_parsing_error(game, ERR_MALLOC);
+	if (!ok)
+		handle_parsing_error(game, ERR_CUBC);
+}
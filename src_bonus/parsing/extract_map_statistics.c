@@ -15,17 +15,13 @@
 static int	process_texture_config(t_game *game, char *config_line)
 {
 	if (!ft_strncmp(config_line, "NO ", 3))
-		extract_texture(game, &game->textures.north.path,
-			ft_split(config_line, ' '));
+		extract_texture(game, &game->textures.north.path, config_line);
 	else if (!ft_strncmp(config_line, "SO ", 3))
-		extract_texture(game, &game->textures.south.path,
-			ft_split(config_line, ' '));
+		extract_texture(game, &game->textures.south.path, config_line);
 	else if (!ft_strncmp(config_line, "WE ", 3))
-		extract_texture(game, &game->textures.west.path,
-			ft_split(config_line, ' '));
+		extract_texture(game, &game->textures.west.path, config_line);
 	else if (!ft_strncmp(config_line, "EA ", 3))
-		extract_texture(game, &game->textures.east.path,
-			ft_split(config_line, ' '));
+		extract_texture(game, &game->textures.east.path, config_line);
 	else
 		return (0);
 	return (1);
@@ -34,11 +30,9 @@ static int	process_texture_config(t_game *game, char *config_line)
 static int	process_color_config(t_game *game, char *config_line)
 {
 	if (!ft_strncmp(config_line, "F ", 2))
-		extract_rgb_colors(game, game->map.floor_rgb,
-			ft_split(config_line, ' '));
+		extract_rgb_colors(game, game->map.floor_rgb, config_line);
 	else if (!ft_strncmp(config_line, "C ", 2))
-		extract_rgb_colors(game, game->map.ceiling_rgb,
-			ft_split(config_line, ' '));
+		extract_rgb_colors(game, game->map.ceiling_rgb, config_line);
 	else
 		return (0);
 	return (1);
@@ -46,20 +40,21 @@ static int	process_color_config(t_game *game, char *config_line)
 
 /**
  * @brief Extract configuration data from a single line
+ *
+ * The element count lives in the map, not in a static, so several maps
+ * can be parsed one after another or side by side.
  */
 
 int	extract_map_statistics(t_game *game, char *config_line)
 {
-	static int	elements_processed = 0;
-
-	while (elements_processed < 6)
+	while (game->map.elements < 6)
 	{
 		if (config_line[0] == ' ' && !config_line[1])
 			return (0);
 		if (process_texture_config(game, config_line)
 			|| process_color_config(game, config_line))
 		{
-			elements_processed++;
+			game->map.elements++;
 			return (0);
 		}
 		handle_parsing_error(game, "Error\nInvalid configuration element\n");
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   page_advice.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+/**
+ * @brief madvise a byte range, rounded to the host page size
+ *
+ * MADV_DONTNEED only drops the pages lying wholly inside the range, so a
+ * page still shared with live bytes is kept; any other advice covers every
+ * page the range touches. The file layout aligns to 4 KiB, which need not
+ * be a whole page here.
+ */
+
+void	advise_range(void *addr, size_t len, int advice)
+{
+	long		page;
+	uintptr_t	start;
+	uintptr_t	end;
+
+	page = sysconf(_SC_PAGESIZE);
+	if (page < 1)
+		page = CHUNK_BYTES;
+	start = (uintptr_t)addr;
+	end = start + len;
+	if (advice == MADV_DONTNEED)
+	{
+		start += (page - start % page) % page;
+		end -= end % page;
+	}
+	else
+		start -= start % page;
+	if (end > start)
+		madvise((void *)start, end - start, advice);
+}
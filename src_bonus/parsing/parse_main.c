@@ -12,64 +12,77 @@
 
 #include "../../includes_bonus/cub3d.h"
 
+/**
+ * @brief A batch worker gets the failure through map.bail like any other
+ * parse error; the launcher prints it and unwinds through its caller
+ */
+
 int	validate_parsed_map(t_game *game)
 {
-	if (!validate_map_walls(game))
-	{
-		ft_printf("Error\nMap is not properly enclosed by walls\n");
-		return (0);
-	}
-	return (1);
+	if (validate_map_walls(game))
+		return (1);
+	if (game->map.bail)
+		handle_parsing_error(game, ERR_MAP_NOT_ENCLOSED);
+	ft_printf("%s", ERR_MAP_NOT_ENCLOSED);
+	return (0);
 }
 
+/**
+ * @brief Free everything the parse owns and stop it
+ *
+ * Exits the process, unless a batch worker armed map.bail: then the
+ * message is kept in map.error and control jumps back to that worker.
+ */
+
 void	handle_parsing_error(t_game *game, char *error_message)
 {
-	ft_printf("%s", error_message);
-	if (game->map.grid)
-		free_string_array(game->map.grid);
+	if (!game->map.bail)
+		ft_printf("%s", error_message);
+	free_map_grid(&game->map);
 	if (game->map.current_line)
 		free(game->map.current_line);
-	if (game->map.data_buffer)
-		free(game->map.data_buffer);
+	unmap_cub_file(&game->map);
+	arena_release(&game->map.arena);
 	free_texture_paths(game);
+	free_map_acceleration(&game->map);
+	if (game->map.bail)
+	{
+		game->map.error = error_message;
+		longjmp(*game->map.bail, 1);
+	}
 	exit(EXIT_FAILURE);
 }
 
+/**
+ * @brief Measure and check the grid; finish_map_rows already padded
+ * every row to the same width
+ */
+
 void	normalize_map_dimensions(t_game *g)
 {
-	int	i;
-
-	calculate_map_dimensions(g, g->map.grid, 0, 0);
+	calculate_map_dimensions(g);
 	if (!g->map.height || !g->map.width)
 		handle_parsing_error(g, ERR_INVALID_MAP);
-	i = 0;
-	while (g->map.grid[i])
-	{
-		if (get_string_length_no_newline(g->map.grid[i]) < g->map.width)
-		{
-			g->map.grid[i] = resize(g->map.grid[i], g->map.width);
-			if (!g->map.grid[i])
-				handle_parsing_error(g, ERR_MALLOC);
-		}
-		i++;
-	}
 }
 
 static int	process_map_line(t_game *g, char *line, int *parsing)
 {
+	char	*row;
+	size_t	len;
+
 	g->map.current_line = line;
 	if (line[0] == '\n')
 		line[0] = ' ';
 	if (!*parsing)
 		*parsing = extract_map_statistics(g, line);
-	if (*parsing && ft_strchr(line, '/'))
+	if (*parsing)
 	{
-		free(line);
-		g->map.current_line = NULL;
-		return (handle_parsing_error(g, ERR_INVALID_MAP), 0);
+		len = get_string_length_no_newline(line);
+		row = arena_strndup(&g->map.arena, line, len);
+		if (!row)
+			handle_parsing_error(g, ERR_MALLOC);
+		append_map_row(g, row, len);
 	}
-	if (*parsing)
-		g->map.data_buffer = join_strings(g->map.data_buffer, line);
 	free(line);
 	g->map.current_line = NULL;
 	return (1);
@@ -79,8 +92,9 @@ int	read_and_parse_map_file(int fd, t_game *g)
 {
 	char	*line;
 	int		parsing;
-	char	*buffer;
 
+	if (map_cub_file(fd, &g->map))
+		return (scan_mapped_cub_file(g));
 	parsing = 0;
 	line = get_next_line(fd);
 	while (line)
@@ -89,9 +103,8 @@ int	read_and_parse_map_file(int fd, t_game *g)
 			return (0);
 		line = get_next_line(fd);
 	}
-	buffer = "";
-	if (g->map.data_buffer)
-		buffer = g->map.data_buffer;
-	g->map.grid = ft_split(buffer, '/');
-	return (free(g->map.data_buffer), g->map.data_buffer = NULL, 1);
+	if (errno)
+		handle_parsing_error(g, ERR_FILE_READ);
+	finish_map_rows(g);
+	return (1);
 }
@@ -12,90 +12,70 @@
 
 #include "../../includes_bonus/cub3d.h"
 
-int	count_elems(char **v)
-{
-	int	i;
-
-	i = 0;
-	while (v && v[i])
-		i++;
-	return (i);
-}
+/**
+ * @brief Yield the next space-separated token of a header line as a view
+ *
+ * The line ends at '\0' or '\n', so both loader paths see the same
+ * tokens; nothing is allocated or written.
+ * @return 1 if a token was found, 0 at the end of the line
+ */
 
-void	strip_trailing_nl(char *s)
+int	next_header_token(const char **cursor, t_token *token)
 {
-	size_t	len;
+	const char	*s;
 
-	if (!s)
-		return ;
-	len = ft_strlen(s);
-	if (len && s[len - 1] == '\n')
-		s[len - 1] = '\0';
+	s = *cursor;
+	while (*s == ' ')
+		s++;
+	token->start = s;
+	while (*s && *s != ' ' && *s != '\n')
+		s++;
+	token->len = s - token->start;
+	*cursor = s;
+	return (token->len > 0);
 }
 
-int	is_number(const char *s)
+/**
+ * @brief Split a header line into at most max token views
+ * @return The total number of tokens, which may exceed max
+ */
+
+int	tokenize_header_line(const char *line, t_token *tokens, int max)
 {
-	int	i;
+	t_token	token;
+	int		count;
 
-	if (!s || !*s)
-		return (0);
-	i = 0;
-	while (s[i])
+	count = 0;
+	while (next_header_token(&line, &token))
 	{
-		if (!ft_isdigit((unsigned char)s[i]))
-			return (0);
-		i++;
+		if (count < max)
+			tokens[count] = token;
+		count++;
 	}
-	return (1);
+	return (count);
 }
 
-void	extract_texture(t_game *game, char **tex_path, char **split_line)
+void	extract_texture(t_game *game, char **tex_path, char *config_line)
 {
-	int	n;
+	t_token	tokens[2];
 
-	n = count_elems(split_line);
-	if (n >= 1)
-		strip_trailing_nl(split_line[n - 1]);
-	if (n != 2 || *tex_path != NULL)
-	{
-		free_string_array(split_line);
+	if (tokenize_header_line(config_line, tokens, 2) != 2 || *tex_path)
 		handle_parsing_error(game,
 			"Error\nInvalid or duplicate texture definition\n");
-	}
-	*tex_path = ft_strdup(split_line[1]);
+	*tex_path = ft_strndup(tokens[1].start, tokens[1].len);
 	if (!*tex_path)
-	{
-		free_string_array(split_line);
 		handle_parsing_error(game,
 			"Error\nMemory allocation failed for texture path\n");
-	}
-	strip_trailing_nl(*tex_path);
-	free_string_array(split_line);
 }
 
-int	validate_rgb_line_format(char *rgb_line)
-{
-	int	i;
-	int	commas;
+/**
+ * @brief Texture path fields in .cubc order: NO, SO, WE, EA
+ */
 
-	if (!rgb_line)
-		return (0);
-	strip_trailing_nl(rgb_line);
-	if (!ft_isdigit((unsigned char)rgb_line[0]))
-		return (0);
-	i = 0;
-	commas = 0;
-	while (rgb_line[i])
-	{
-		if (rgb_line[i] == ',')
-		{
-			commas++;
-			if (rgb_line[i + 1] == ',' || rgb_line[i + 1] == '\0')
-				return (0);
-		}
-		else if (!ft_isdigit((unsigned char)rgb_line[i]))
-			return (0);
-		i++;
-	}
-	return (commas == 2);
+void	texture_path_slots(t_game *game, char ***slots)
+{
+	slots[0] = &game->textures.north.path;
+	slots[1] = &game->textures.south.path;
+	slots[2] = &game->textures.west.path;
+	slots[3] = &game->textures.east.path;
 }
@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   row_closure.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_bonus/cub3d.h"
+
+static int	is_open_at(const char *row, int x)
+{
+	return (!row || !row[x] || row[x] == ' ');
+}
+
+/**
+ * @brief Check that no walkable cell of row touches a space or the border
+ *
+ * Rows are padded to the map width, and a NULL above/below row is the
+ * map border, so this needs nothing beyond the three rows it is given.
+ */
+
+int	is_enclosed_row(const char *above, const char *row, const char *below)
+{
+	int	x;
+
+	x = 0;
+	while (row[x])
+	{
+		if (row[x] != '1' && row[x] != ' ')
+		{
+			if (x == 0 || is_open_at(row, x - 1) || is_open_at(row, x + 1)
+				|| is_open_at(above, x) || is_open_at(below, x))
+				return (0);
+		}
+		x++;
+	}
+	return (1);
+}
@@ -52,6 +52,19 @@ static void	draw_textured_wall_pixel(t_game *game, int screen_x,
 	put_pixel_to_image(game, screen_x, screen_y, pixel_color);
 }
 
+/**
+ * @brief Draw a column whose texture is still loading in its flat colour
+ */
+
+static void	draw_flat_wall_column(t_game *game, int screen_x, int color)
+{
+	while (game->wall.draw_start < game->wall.draw_end)
+	{
+		put_pixel_to_image(game, screen_x, game->wall.draw_start, color);
+		game->wall.draw_start++;
+	}
+}
+
 void	draw_wall_column(t_game *game, int screen_x)
 {
 	int	line_height;
@@ -59,11 +72,18 @@ void	draw_wall_column(t_game *game, int screen_x)
 
 	calculate_wall_line_parameters(game, &line_height,
 		&game->wall.draw_start, &game->wall.draw_end);
-	calculate_texture_coordinates(game, game->wall.draw_start, line_height);
 	texture_index = determine_wall_texture(game);
+	if (!wall_texture_ready(game, texture_index))
+	{
+		draw_flat_wall_column(game, screen_x,
+			game->textures.face[texture_index]->average);
+		return ;
+	}
+	calculate_texture_coordinates(game, game->wall.draw_start, line_height,
+		texture_index);
 	while (game->wall.draw_start < game->wall.draw_end)
 	{
-		game->wall.tex_y = (int)game->wall.tex_pos & (TEXTURE_SIZE - 1);
+		game->wall.tex_y = (int)game->wall.tex_pos % game->wall.tex_height;
 		game->wall.tex_pos += game->wall.tex_step;
 		draw_textured_wall_pixel(game, screen_x, game->wall.draw_start,
 			texture_index);
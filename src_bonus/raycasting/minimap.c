@@ -12,11 +12,27 @@
 
 #include "../../includes_bonus/cub3d.h"
 
-static int	get_cell_color(t_game *game, char cell_char)
+/**
+ * @brief Read a cell from the text grid, or from its chunk page when the
+ * map was loaded from a compiled file
+ */
+
+static char	map_cell_at(t_map *map, int x, int y)
 {
-	if (cell_char == '1')
+	if (map->grid)
+		return (map->grid[y][x]);
+	return (map->chunk_cells[(((size_t)(y >> 6) * map->macros_w + (x >> 6))
+			<< 12) | ((y & 63) << 6) | (x & 63)]);
+}
+
+static int	get_cell_color(t_game *game, int col, int row)
+{
+	char	cell_char;
+
+	if (is_wall_cell(&game->map, col, row))
 		return (COLOR_BLACK);
-	else if (cell_char == '0' || is_character_valid(cell_char, "NSEW"))
+	cell_char = map_cell_at(&game->map, col, row);
+	if (cell_char == '0' || is_character_valid(cell_char, "NSEW"))
 		return (create_trgb_color(0, game->map.ceiling_rgb[0],
 				game->map.ceiling_rgb[1], game->map.ceiling_rgb[2]));
 	else
@@ -28,15 +44,17 @@ void	draw_minimap_display(t_game *game)
 	int	row_index;
 	int	col_index;
 
+	center_minimap_on_player(game);
 	row_index = 0;
-	while (game->map.grid[row_index])
+	while (row_index < game->minimap.rows)
 	{
 		col_index = 0;
-		while (game->map.grid[row_index][col_index])
+		while (col_index < game->minimap.cols)
 		{
 			draw_minimap_case(game, col_index * MINIMAP_SCALE,
 				row_index * MINIMAP_SCALE,
-				get_cell_color(game, game->map.grid[row_index][col_index]));
+				get_cell_color(game, game->minimap.origin_x + col_index,
+					game->minimap.origin_y + row_index));
 			col_index++;
 		}
 		row_index++;
@@ -48,18 +66,22 @@ void	update_minimap_player_position(t_game *game, int previous_x,
 {
 	int	background_color;
 
-	draw_minimap_case(game, (int)game->player.pos_x * MINIMAP_SCALE,
-		(int)game->player.pos_y * MINIMAP_SCALE, COLOR_PLAYER);
-	if ((int)game->player.pos_x != previous_x
-		|| (int)game->player.pos_y != previous_y)
+	draw_minimap_case(game,
+		((int)game->view.pos_x - game->minimap.origin_x) * MINIMAP_SCALE,
+		((int)game->view.pos_y - game->minimap.origin_y) * MINIMAP_SCALE,
+		COLOR_PLAYER);
+	if ((int)game->view.pos_x != previous_x
+		|| (int)game->view.pos_y != previous_y)
 	{
-		if (game->map.grid[previous_y][previous_x] == '1')
+		if (is_wall_cell(&game->map, previous_x, previous_y))
 			background_color = COLOR_BLACK;
 		else
 			background_color = create_trgb_color(0, game->map.ceiling_rgb[0],
 					game->map.ceiling_rgb[1], game->map.ceiling_rgb[2]);
-		draw_minimap_case(game, previous_x * MINIMAP_SCALE,
-			previous_y * MINIMAP_SCALE, background_color);
+		draw_minimap_case(game,
+			(previous_x - game->minimap.origin_x) * MINIMAP_SCALE,
+			(previous_y - game->minimap.origin_y) * MINIMAP_SCALE,
+			background_color);
 	}
 }
 
@@ -67,7 +89,8 @@ void	put_pixel_to_minimap(t_game *game, int x, int y, int color)
 {
 	char	*pixel_address;
 
-	if (y < 0 || y >= game->mlx.height || x < 0 || x >= game->mlx.width)
+	if (y < 0 || y >= game->textures.minimap.height
+		|| x < 0 || x >= game->textures.minimap.width)
 		return ;
 	pixel_address = game->textures.minimap.data
 		+ (y * game->textures.minimap.line_length
@@ -32,12 +32,9 @@ static void	draw_bold_pixel(t_game *game, int x, int y, int color)
 
 static int	should_break_line(t_game *game, double line_x, double line_y)
 {
-	if (line_x < 0 || line_y < 0 || line_x >= game->map.width
-		|| line_y >= game->map.height)
+	if (line_x < 0 || line_y < 0)
 		return (1);
-	if (game->map.grid[(int)line_y][(int)line_x] == '1')
-		return (1);
-	return (0);
+	return (is_wall_cell(&game->map, (int)line_x, (int)line_y));
 }
 
 static void	draw_direction_steps(t_game *game, double line_x,
@@ -47,13 +44,15 @@ static void	draw_direction_steps(t_game *game, double line_x,
 	double	step_y;
 	int		i;
 
-	step_x = game->player.dir_x * 0.2;
-	step_y = game->player.dir_y * 0.2;
+	step_x = game->view.dir_x * 0.2;
+	step_y = game->view.dir_y * 0.2;
 	i = 0;
 	while (i < 15)
 	{
-		draw_bold_pixel(game, (int)(line_x * MINIMAP_SCALE),
-			(int)(line_y * MINIMAP_SCALE), 0xFF0000);
+		draw_bold_pixel(game,
+			(int)((line_x - game->minimap.origin_x) * MINIMAP_SCALE),
+			(int)((line_y - game->minimap.origin_y) * MINIMAP_SCALE),
+			0xFF0000);
 		line_x += step_x;
 		line_y += step_y;
 		if (should_break_line(game, line_x, line_y))
@@ -67,7 +66,7 @@ void	draw_player_direction_line(t_game *game)
 	double	line_x;
 	double	line_y;
 
-	line_x = game->player.pos_x;
-	line_y = game->player.pos_y;
+	line_x = game->view.pos_x;
+	line_y = game->view.pos_y;
 	draw_direction_steps(game, line_x, line_y);
 }
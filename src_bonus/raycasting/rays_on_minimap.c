@@ -25,7 +25,7 @@ static int	is_wall_hit(t_game *game, int map_x, int map_y)
 {
 	if (is_ray_out_of_bounds(game, map_x, map_y))
 		return (1);
-	if (game->map.grid[map_y][map_x] == '1')
+	if (is_wall_cell(&game->map, map_x, map_y))
 		return (1);
 	return (0);
 }
@@ -35,8 +35,8 @@ static void	draw_ray_pixel(t_game *game, double ray_x, double ray_y)
 	int	pixel_x;
 	int	pixel_y;
 
-	pixel_x = (int)(ray_x * MINIMAP_SCALE);
-	pixel_y = (int)(ray_y * MINIMAP_SCALE);
+	pixel_x = (int)((ray_x - game->minimap.origin_x) * MINIMAP_SCALE);
+	pixel_y = (int)((ray_y - game->minimap.origin_y) * MINIMAP_SCALE);
 	put_pixel_to_minimap(game, pixel_x, pixel_y, 0xFF0000);
 }
 
@@ -57,8 +57,8 @@ void	draw_ray_on_minimap(t_game *game, double ray_dir_x, double ray_dir_y)
 	int		map_x;
 	int		i;
 
-	ray_x = game->player.pos_x;
-	ray_y = game->player.pos_y;
+	ray_x = game->view.pos_x;
+	ray_y = game->view.pos_y;
 	i = 0;
 	while (i < 150)
 	{
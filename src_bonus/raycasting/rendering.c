@@ -14,16 +14,28 @@
 
 int	render_frame(t_game *game)
 {
-	process_movement_input(game);
+	take_pose_snapshot(game);
+	update_chunk_pager(game);
+	update_texture_residency(game);
 	render_background_colors(game);
 	execute_raycasting(game);
 	draw_minimap_display(game);
 	draw_player_direction_line(game);
-	draw_minimap_case(game, (int)game->player.pos_x * MINIMAP_SCALE,
-		(int)game->player.pos_y * MINIMAP_SCALE, COLOR_PLAYER);
+	draw_minimap_case(game,
+		((int)game->view.pos_x - game->minimap.origin_x) * MINIMAP_SCALE,
+		((int)game->view.pos_y - game->minimap.origin_y) * MINIMAP_SCALE,
+		COLOR_PLAYER);
 	mlx_put_image_to_window(game->mlx.instance, game->mlx.window,
 		game->textures.screen.mlx_ptr, 0, 0);
 	mlx_put_image_to_window(game->mlx.instance, game->mlx.window,
 		game->textures.minimap.mlx_ptr, MINIMAP_OFFSET, MINIMAP_OFFSET);
+	if (game->session.mode == SESSION_REPLAY)
+		record_replay_frame(game);
+	if (game->view.input_us)
+		record_input_latency(game);
+	if (game->start_us)
+		print_first_frame_report(game);
+	if (game->startup.enabled && !game->textures.flat_columns)
+		finish_startup_report(game);
 	return (0);
 }
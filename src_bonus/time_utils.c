@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_utils.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_bonus/cub3d.h"
+
+long long	get_time_us(void)
+{
+	struct timeval	now;
+
+	gettimeofday(&now, NULL);
+	return ((long long)now.tv_sec * 1000000LL + now.tv_usec);
+}
+
+/**
+ * @brief Print how long each map loading step took
+ * @param stamps Start, parsed, validated and accelerated timestamps (us)
+ */
+
+void	print_map_load_report(t_game *game, long long *stamps)
+{
+	printf("Map %dx%d loaded in %.1f ms (parse %.1f ms, validate %.1f ms, "
+		"acceleration %.1f ms)\n", game->map.width, game->map.height,
+		(stamps[3] - stamps[0]) / 1000.0, (stamps[1] - stamps[0]) / 1000.0,
+		(stamps[2] - stamps[1]) / 1000.0, (stamps[3] - stamps[2]) / 1000.0);
+}
+
+/**
+ * @brief Print, once, how long it took from launch to the first frame
+ * being handed to the window
+ */
+
+void	print_first_frame_report(t_game *game)
+{
+	record_startup_phase(game, "first frame");
+	printf("First frame after %.1f ms\n",
+		(get_time_us() - game->start_us) / 1000.0);
+	game->start_us = 0;
+}
@@ -12,13 +12,11 @@
 
 #include "../includes_bonus/cub3d.h"
 
-static int	validate_file_extension(char *filename)
+int	has_file_extension(char *filename, char *ext)
 {
-	char	*ext;
 	size_t	len;
 	size_t	ext_len;
 
-	ext = ".cub";
 	len = ft_strlen(filename);
 	ext_len = ft_strlen(ext);
 	if (len < ext_len)
@@ -42,6 +40,13 @@ int	validate_arguments(int argc, char **argv)
 	{
 		printf("Error\nUsage: %s <map_file.cub>\n", argv[0]);
 		printf("Expected exactly one argument: path to .cub file\n");
+		printf("Or: %s --validate [--map-threads=<n>] <map_file.cub>...\n",
+			argv[0]);
+		printf("Or: %s --compile <map_file.cub> <map_file.cubc>\n", argv[0]);
+		printf("Options before the map: --no-texture-cache "
+			"--texture-budget=<KiB> --chunk-budget=<KiB> --map-threads=<n> "
+			"--startup-report --record=<file> --replay=<file> "
+			"--mouse-sensitivity=<mrad/px>\n");
 		return (0);
 	}
 	return (1);
@@ -54,7 +59,6 @@ int	is_parseable_map_file(t_game *game, int fd)
 	if (!parse_map_file(game, fd))
 	{
 		handle_parsing_error(game, "Freed all memory");
-		close(fd);
 		return (0);
 	}
 	return (1);
@@ -66,9 +70,10 @@ int	validate_input_file(char *filename)
 	int		read_result;
 	char	test_buffer[1];
 
-	if (!validate_file_extension(filename))
+	if (!has_file_extension(filename, ".cub")
+		&& !has_file_extension(filename, ".cubc"))
 	{
-		printf("Error\nInvalid file extension. Expected: .cub\n");
+		printf("Error\nInvalid file extension. Expected: .cub or .cubc\n");
 		return (0);
 	}
 	fd = open(filename, O_RDONLY);
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Print one --validate line; parse errors are shown without their
+ * "Error\n" prefix and trailing newline
+ */
+
+static void	print_batch_result(char *path, t_batch_result *result)
+{
+	const char	*message;
+	int			len;
+
+	if (!result->error)
+	{
+		printf("OK   %s %dx%d %.1f ms\n", path, result->width,
+			result->height, result->elapsed_us / 1000.0);
+		return ;
+	}
+	message = result->error;
+	if (!ft_strncmp(message, "Error\n", 6))
+		message += 6;
+	len = 0;
+	while (message[len] && message[len] != '\n')
+		len++;
+	printf("FAIL %s %.1f ms: %.*s\n", path, result->elapsed_us / 1000.0,
+		len, message);
+}
+
+/**
+ * @brief Print every --validate result in argument order and a summary
+ * @return Number of maps that failed
+ */
+
+int	print_batch_report(t_batch *batch, long long elapsed_us)
+{
+	int	index;
+	int	failed;
+
+	index = 0;
+	failed = 0;
+	while (index < batch->count)
+	{
+		print_batch_result(batch->files[index], &batch->results[index]);
+		if (batch->results[index].error)
+			failed++;
+		index++;
+	}
+	printf("Validated %d maps in %.1f ms: %d failed\n", batch->count,
+		elapsed_us / 1000.0, failed);
+	return (failed);
+}
@@ -14,6 +14,7 @@
 
 void	free_texture_paths(t_game *game)
 {
+	finish_texture_decoding(game);
 	if (game->textures.north.path)
 	{
 		free(game->textures.north.path);
@@ -40,7 +41,7 @@ void	free_string_array(char **string_array)
 {
 	int	string_index;
 
-	if (!string_array)
+	if (!string_array && !*string_array)
 		return ;
 	string_index = 0;
 	while (string_array[string_index])
@@ -59,9 +60,41 @@ void	free_parsing_buffers(t_game *game)
 		free(game->map.current_line);
 		game->map.current_line = NULL;
 	}
-	if (game->map.data_buffer)
+	unmap_cub_file(&game->map);
+	arena_release(&game->map.arena);
+}
+
+/**
+ * @brief Free the grid; a compiled map has none, its chunks live in the
+ * mapping
+ */
+
+void	free_map_grid(t_map *map)
+{
+	if (!map->grid)
+		return ;
+	free_string_array(map->grid);
+	map->grid = NULL;
+}
+
+/**
+ * @brief Free the wall bitmaps and distance field built after parsing
+ */
+
+void	free_map_acceleration(t_map *map)
+{
+	if (map->wall_bits && !map->compiled)
+		free(map->wall_bits);
+	map->wall_bits = NULL;
+	if (map->macro_bits && !map->compiled)
+		free(map->macro_bits);
+	map->macro_bits = NULL;
+	if (map->wall_distance)
 	{
-		free(game->map.data_buffer);
-		game->map.data_buffer = NULL;
+		free(map->wall_distance);
+		map->wall_distance = NULL;
 	}
+	map->tiles_w = 0;
+	map->tiles_h = 0;
+	map->empty_blocks = 0;
 }
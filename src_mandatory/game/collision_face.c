@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   collision_face.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+static int	is_wall_across(t_map *map, int axis, int along, int across)
+{
+	if (axis == 0)
+		return (is_wall_cell(map, along, across));
+	return (is_wall_cell(map, across, along));
+}
+
+/**
+ * @brief Fraction of the slide along the face in contact that stays on
+ * it; past a convex corner the rest of the move has to turn around the
+ * corner instead, while a wall closing the run is left to the sweep
+ */
+
+static double	face_run_fraction(t_sweep *s, t_map *map, int axis)
+{
+	int		wall;
+	int		cell;
+	int		step;
+	double	edge;
+
+	step = 1;
+	if (s->d[!axis] < 0.0)
+		step = -1;
+	wall = (int)floor(s->p[axis] - s->n[axis] * (s->r + 0.5));
+	cell = (int)floor(s->p[!axis]);
+	edge = (cell + (step > 0) - s->p[!axis]) * step;
+	while (edge < fabs(s->d[!axis]))
+	{
+		if (is_wall_across(map, axis, wall + (int)s->n[axis], cell + step))
+			return (1.0);
+		if (!is_wall_across(map, axis, wall, cell + step))
+			return (edge / fabs(s->d[!axis]));
+		cell += step;
+		edge += 1.0;
+	}
+	return (1.0);
+}
+
+/**
+ * @brief Set up the next sweep from pos: the rest of the input, or
+ * while pressing into the face last hit, its slide along that face
+ *
+ * Returns the fraction of the remaining input the sweep stands for.
+ */
+
+double	plan_collision_pass(t_sweep *s, t_map *map, double *pos)
+{
+	int		axis;
+	double	part;
+
+	s->p[0] = pos[0];
+	s->p[1] = pos[1];
+	s->d[0] = s->in[0];
+	s->d[1] = s->in[1];
+	axis = (s->n[0] == 0.0);
+	if (s->hit != 1 || s->in[axis] * s->n[axis] >= 0.0)
+		return (1.0);
+	s->d[axis] = 0.0;
+	part = face_run_fraction(s, map, axis);
+	s->d[!axis] *= part;
+	return (part);
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   collision_slide.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief tan(a / 2) for the angle a from direction u to normal n: 0 when
+ * they point the same way, HUGE_VAL when they are opposite
+ */
+
+static double	tan_half_angle(double *u, double nx, double ny)
+{
+	double	sine;
+	double	cosine;
+
+	sine = u[0] * ny - u[1] * nx;
+	cosine = u[0] * nx + u[1] * ny;
+	if (sine == 0.0 && cosine > 0.0)
+		return (0.0);
+	if (sine == 0.0)
+		return (HUGE_VAL);
+	return ((1.0 - cosine) / sine);
+}
+
+/**
+ * @brief Where sliding around a corner ends, as |tan(a / 2)|: at a right
+ * angle to the move (1), or earlier where the arc meets one of the two
+ * faces and the move keeps pressing into it
+ */
+
+static double	arc_release(double *u, double *e, double h0)
+{
+	double	stop;
+	double	face;
+
+	stop = 1.0;
+	face = tan_half_angle(u, e[0], 0.0);
+	if (face * h0 > 0.0 && fabs(face) < fabs(h0) && fabs(face) > stop)
+		stop = fabs(face);
+	face = tan_half_angle(u, 0.0, e[1]);
+	if (face * h0 > 0.0 && fabs(face) < fabs(h0) && fabs(face) > stop)
+		stop = fabs(face);
+	return (stop);
+}
+
+/**
+ * @brief Follow the arc around the corner s->p while pushing along u for
+ * u[2] cells
+ *
+ * Pushing with a fixed direction against a circle turns the contact
+ * normal towards the tangent so that tan(a / 2) decays as exp(-s / r)
+ * over the distance s pushed; solving that directly gives the position
+ * any number of smaller steps converges to.
+ */
+
+static void	follow_corner_arc(t_sweep *s, double *pos, double *u, double *e)
+{
+	double	h[2];
+	double	stop;
+
+	h[0] = tan_half_angle(u, s->n[0], s->n[1]);
+	h[1] = h[0] * exp(-u[2] / s->r);
+	stop = arc_release(u, e, h[0]);
+	if (fabs(h[1]) < stop)
+		h[1] = copysign(stop, h[0]);
+	u[2] = fmax(0.0, u[2] - s->r * log(h[0] / h[1]));
+	e[0] = (1.0 - h[1] * h[1]) / (1.0 + h[1] * h[1]);
+	e[1] = 2.0 * h[1] / (1.0 + h[1] * h[1]);
+	pos[0] = s->p[0] + (s->r + COLLISION_SKIN) * (e[0] * u[0] - e[1] * u[1]);
+	pos[1] = s->p[1] + (s->r + COLLISION_SKIN) * (e[0] * u[1] + e[1] * u[0]);
+	s->in[0] = u[0] * u[2];
+	s->in[1] = u[1] * u[2];
+}
+
+/**
+ * @brief Continue from a corner contact: around the corner when the
+ * input presses into it, straight on when it only grazes it, and not at
+ * all when pushing head-on or into a corner pinched by a diagonal wall,
+ * where the arc would leave open cells
+ */
+
+static void	slide_around_corner(t_sweep *s, t_map *map, double *pos)
+{
+	double	u[3];
+	double	e[2];
+	double	h0;
+
+	u[2] = hypot(s->in[0], s->in[1]);
+	u[0] = s->in[0] / u[2];
+	u[1] = s->in[1] / u[2];
+	e[0] = copysign(1.0, s->n[0]);
+	e[1] = copysign(1.0, s->n[1]);
+	s->p[0] = pos[0] - s->r * s->n[0];
+	s->p[1] = pos[1] - s->r * s->n[1];
+	pos[0] += s->n[0] * COLLISION_SKIN;
+	pos[1] += s->n[1] * COLLISION_SKIN;
+	s->hit = 0;
+	h0 = tan_half_angle(u, s->n[0], s->n[1]);
+	if (fabs(h0) <= 1.0)
+		return ;
+	if (h0 == HUGE_VAL || is_wall_cell(map, (int)floor(s->p[0] + 0.5 * e[0]),
+		(int)floor(s->p[1] + 0.5 * e[1])))
+	{
+		s->in[0] = 0.0;
+		s->in[1] = 0.0;
+		return ;
+	}
+	follow_corner_arc(s, pos, u, e);
+}
+
+/**
+ * @brief Move a circle of PLAYER_RADIUS centred on pos by (dx, dy),
+ * sliding along what it hits
+ *
+ * s.in is the input still to apply. Each pass sweeps it, or its slide
+ * along the face in contact up to where that face ends, and charges the
+ * part travelled against it, so pushing into a wall at an angle slides
+ * along it and around its corners the same way however the move was
+ * split into frames.
+ */
+
+void	slide_circle(t_map *map, double *pos, double dx, double dy)
+{
+	t_sweep	s;
+	double	part;
+	int		pass;
+
+	s.r = PLAYER_RADIUS;
+	s.in[0] = dx;
+	s.in[1] = dy;
+	s.hit = 0;
+	pass = -1;
+	while (++pass < COLLISION_PASSES && (s.in[0] != 0.0 || s.in[1] != 0.0))
+	{
+		part = plan_collision_pass(&s, map, pos);
+		sweep_wall_grid(&s, map);
+		pos[0] += s.t * s.d[0];
+		pos[1] += s.t * s.d[1];
+		s.in[0] *= 1.0 - part * s.t;
+		s.in[1] *= 1.0 - part * s.t;
+		if (s.hit == 2)
+			slide_around_corner(&s, map, pos);
+		else if (s.hit)
+		{
+			pos[0] += s.n[0] * COLLISION_SKIN;
+			pos[1] += s.n[1] * COLLISION_SKIN;
+		}
+	}
+}
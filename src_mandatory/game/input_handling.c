@@ -12,39 +12,25 @@
 
 #include "../../includes_mandatory/cub3d.h"
 
+/**
+ * @brief X callbacks only queue their event; the next simulation tick
+ * applies it. Escape still quits at once; during a replay it is the only
+ * live input taken.
+ */
+
 int	handle_key_press(int keycode, t_game *game)
 {
 	if (keycode == KEY_ESC)
 		clean_exit_program(game);
-	else if (keycode == KEY_W)
-		game->player.key_w = 1;
-	else if (keycode == KEY_S)
-		game->player.key_s = 1;
-	else if (keycode == KEY_A)
-		game->player.key_a = 1;
-	else if (keycode == KEY_D)
-		game->player.key_d = 1;
-	else if (keycode == KEY_LEFT)
-		game->player.key_left = 1;
-	else if (keycode == KEY_RIGHT)
-		game->player.key_right = 1;
+	if (game->session.mode != SESSION_REPLAY)
+		push_input_event(&game->input, INPUT_KEY_PRESS, keycode, 0);
 	return (0);
 }
 
 int	handle_key_release(int keycode, t_game *game)
 {
-	if (keycode == KEY_W)
-		game->player.key_w = 0;
-	else if (keycode == KEY_S)
-		game->player.key_s = 0;
-	else if (keycode == KEY_A)
-		game->player.key_a = 0;
-	else if (keycode == KEY_D)
-		game->player.key_d = 0;
-	else if (keycode == KEY_LEFT)
-		game->player.key_left = 0;
-	else if (keycode == KEY_RIGHT)
-		game->player.key_right = 0;
+	if (game->session.mode != SESSION_REPLAY)
+		push_input_event(&game->input, INPUT_KEY_RELEASE, keycode, 0);
 	return (0);
 }
 
@@ -73,28 +59,43 @@ static void	process_player_key_input(t_game *game,
 	}
 }
 
+static double	key_turn(t_game *game)
+{
+	double	turn;
+
+	turn = 0.0;
+	if (game->player.key_left)
+		turn -= game->player.rotate_speed;
+	if (game->player.key_right)
+		turn += game->player.rotate_speed;
+	if (game->player.initial_dir != 'N' && game->player.initial_dir != 'S')
+		turn = -turn;
+	return (turn);
+}
+
+/**
+ * @brief One simulation tick of input: drain the queued events, move,
+ * then apply the key and pointer turn as a single rotation. A session
+ * brackets the tick to feed or log its events and its pose checksum.
+ */
+
 void	process_movement_input(t_game *game)
 {
 	double	move_x;
 	double	move_y;
+	double	turn;
 
+	if (game->session.mode && !begin_session_tick(game))
+		return ;
+	turn = drain_input_events(game);
 	move_x = 0.0;
 	move_y = 0.0;
 	process_player_key_input(game, &move_x, &move_y);
 	if (move_x != 0.0 || move_y != 0.0)
 		move_player_with_collision(game, move_x, move_y);
-	if (game->player.key_left)
-	{
-		if (game->player.initial_dir == 'N' || game->player.initial_dir == 'S')
-			rotate_player_view(game, -game->player.rotate_speed);
-		else
-			rotate_player_view(game, game->player.rotate_speed);
-	}
-	if (game->player.key_right)
-	{
-		if (game->player.initial_dir == 'N' || game->player.initial_dir == 'S')
-			rotate_player_view(game, game->player.rotate_speed);
-		else
-			rotate_player_view(game, -game->player.rotate_speed);
-	}
+	turn += key_turn(game);
+	if (turn != 0.0)
+		rotate_player_view(game, turn);
+	if (game->session.mode)
+		end_session_tick(game);
 }
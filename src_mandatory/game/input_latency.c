@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_latency.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Called once a frame drawing a pose that input went into has been
+ * handed to the window: the wait of the oldest event behind that pose is
+ * the worst input-to-present latency of the frame
+ */
+
+void	record_input_latency(t_game *game)
+{
+	long long	latency;
+
+	latency = get_time_us() - game->view.input_us;
+	game->input.presented++;
+	game->input.latency_sum += latency;
+	if (latency > game->input.latency_max)
+		game->input.latency_max = latency;
+	game->view.input_us = 0;
+}
+
+/**
+ * @brief A replay renders one tick per frame as fast as it can, so the
+ * gap between two presents is what that frame cost
+ */
+
+void	record_replay_frame(t_game *game)
+{
+	t_session	*s;
+	long long	now;
+
+	s = &game->session;
+	now = get_time_us();
+	if (s->frames && now - s->last_us > s->frame_max)
+		s->frame_max = now - s->last_us;
+	if (s->frames)
+		s->frame_sum += now - s->last_us;
+	s->last_us = now;
+	s->frames++;
+}
+
+/**
+ * @brief Summarise the input seen this session on exit
+ */
+
+void	print_input_report(t_game *game)
+{
+	t_input_ring	*ring;
+
+	ring = &game->input;
+	if (!ring->presented)
+		return ;
+	printf("Input: %lu events in %lu ticks, %lu dropped, latency to present "
+		"%.2f ms mean, %.2f ms max\n", ring->count, ring->batches,
+		__atomic_load_n(&ring->dropped, __ATOMIC_RELAXED),
+		ring->latency_sum / 1000.0 / ring->presented,
+		ring->latency_max / 1000.0);
+}
@@ -12,25 +12,41 @@
 
 #include "../../includes_mandatory/cub3d.h"
 
-int	is_wall_at_position(t_game *game, int x, int y)
+/**
+ * @brief True when the distance field proves the move cannot reach a wall:
+ * at distance >= 2 every cell one step away is empty, and the circle ends
+ * up less than a cell past its own
+ */
+
+static int	is_move_in_open_space(t_game *game, double delta_x, double delta_y)
 {
-	if (x < 0 || y < 0 || x >= game->map.width || y >= game->map.height)
-		return (1);
-	return (game->map.grid[y][x] == '1');
+	int	cell_x;
+	int	cell_y;
+
+	if (!game->map.wall_distance || fabs(delta_x) + PLAYER_RADIUS >= 1.0
+		|| fabs(delta_y) + PLAYER_RADIUS >= 1.0)
+		return (0);
+	cell_x = (int)game->player.pos_x;
+	cell_y = (int)game->player.pos_y;
+	return (game->map.wall_distance[(size_t)cell_y * game->map.width
+			+ cell_x] >= 2);
 }
 
 void	move_player_with_collision(t_game *game, double delta_x, double delta_y)
 {
-	double	new_x;
-	double	new_y;
-
-	new_x = game->player.pos_x + delta_x;
-	new_y = game->player.pos_y + delta_y;
-	if (delta_x != 0.0 && delta_y != 0.0)
-		handle_diagonal_movement(game, new_x, new_y);
-	else
-		handle_single_axis_movement(game, delta_x, delta_y);
-	revert_invalid_position(game, delta_x, delta_y);
+	double	pos[2];
+
+	if (is_move_in_open_space(game, delta_x, delta_y))
+	{
+		game->player.pos_x += delta_x;
+		game->player.pos_y += delta_y;
+		return ;
+	}
+	pos[0] = game->player.pos_x;
+	pos[1] = game->player.pos_y;
+	slide_circle(&game->map, pos, delta_x, delta_y);
+	game->player.pos_x = pos[0];
+	game->player.pos_y = pos[1];
 }
 
 void	rotate_player_view(t_game *game, double rotation_speed)
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simulation.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Copy the pose into the back slot and swap it into middle; a
+ * pose swapped back out still fresh was never drawn, so its input time
+ * carries over to the next one
+ */
+
+static void	publish_pose(t_game *game)
+{
+	t_simulation	*sim;
+	t_pose			*slot;
+	unsigned int	old;
+
+	sim = &game->sim;
+	slot = &sim->slots[sim->back];
+	slot->pos_x = game->player.pos_x;
+	slot->pos_y = game->player.pos_y;
+	slot->dir_x = game->player.dir_x;
+	slot->dir_y = game->player.dir_y;
+	slot->plane_x = game->player.plane_x;
+	slot->plane_y = game->player.plane_y;
+	slot->input_us = sim->carry_us;
+	if (!slot->input_us)
+		slot->input_us = game->input.batch_us;
+	game->input.batch_us = 0;
+	old = __atomic_exchange_n(&sim->middle, sim->back | POSE_FRESH,
+			__ATOMIC_ACQ_REL);
+	sim->back = old & 3;
+	sim->carry_us = 0;
+	if (old & POSE_FRESH)
+		sim->carry_us = sim->slots[sim->back].input_us;
+}
+
+/**
+ * @brief Run ticks at a fixed rate whatever the renderer is doing; after
+ * a stall it catches up a few ticks back to back, past that it drops them
+ */
+
+static void	*simulation_main(void *arg)
+{
+	t_game		*game;
+	long long	next;
+	long long	now;
+
+	game = arg;
+	next = get_time_us();
+	while (__atomic_load_n(&game->sim.running, __ATOMIC_ACQUIRE))
+	{
+		process_movement_input(game);
+		publish_pose(game);
+		next += SIM_TICK_US;
+		now = get_time_us();
+		if (next > now)
+			usleep(next - now);
+		else if (now - next > SIM_TICK_US * SIM_MAX_LAG)
+			next = now;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Publish the spawn pose, which is also the view until the first
+ * frame, and start ticking. Without a thread the renderer runs one tick
+ * per frame as before; a replay always runs that way, unthrottled, so
+ * every recorded tick is drawn exactly once.
+ */
+
+void	start_simulation(t_game *game)
+{
+	t_simulation	*sim;
+
+	sim = &game->sim;
+	sim->front = 0;
+	sim->middle = 1;
+	sim->back = 2;
+	publish_pose(game);
+	game->view = sim->slots[sim->middle & 3];
+	sim->running = 1;
+	sim->started = 0;
+	if (game->session.mode != SESSION_REPLAY)
+		sim->started = !pthread_create(&sim->thread, NULL, simulation_main,
+				game);
+}
+
+void	stop_simulation(t_game *game)
+{
+	__atomic_store_n(&game->sim.running, 0, __ATOMIC_RELEASE);
+	if (game->sim.started)
+		pthread_join(game->sim.thread, NULL);
+	game->sim.started = 0;
+}
+
+/**
+ * @brief Render side: take the newest pose if one was published since
+ * the last frame. Once the simulation has stopped by itself and its last
+ * pose is on screen, the game ends.
+ */
+
+void	take_pose_snapshot(t_game *game)
+{
+	t_simulation	*sim;
+	int				stopped;
+
+	sim = &game->sim;
+	stopped = !__atomic_load_n(&sim->running, __ATOMIC_ACQUIRE);
+	if (!sim->started && !stopped)
+	{
+		process_movement_input(game);
+		stopped = !__atomic_load_n(&sim->running, __ATOMIC_ACQUIRE);
+		if (!stopped)
+			publish_pose(game);
+	}
+	if (__atomic_load_n(&sim->middle, __ATOMIC_ACQUIRE) & POSE_FRESH)
+	{
+		sim->front = __atomic_exchange_n(&sim->middle, sim->front,
+				__ATOMIC_ACQ_REL) & 3;
+		game->view = sim->slots[sim->front];
+	}
+	else if (stopped)
+		clean_exit_program(game);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_cache.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Find the cache entry for a path, adding an empty one if missing
+ *
+ * Maps often name one file for several faces; each unique path gets a
+ * single entry, decoded once and drawn for all of them via textures.face.
+ */
+
+t_tex_entry	*find_texture_entry(t_game *game, char *path)
+{
+	t_textures	*t;
+	int			i;
+
+	t = &game->textures;
+	i = 0;
+	while (i < t->cache_count && ft_strcmp(t->cache[i].path, path))
+		i++;
+	if (i == t->cache_count)
+	{
+		ft_bzero(&t->cache[i], sizeof(t->cache[i]));
+		t->cache[i].path = path;
+		t->cache[i].lock = &t->lock;
+		t->cache[i].disk_cache = t->disk_cache;
+		t->cache[i].average = TEXTURE_PLACEHOLDER;
+		t->cache_count++;
+	}
+	return (&t->cache[i]);
+}
+
+/**
+ * @brief Decode a texture file with the decoder its extension names;
+ * anything that is not .qoi or .ppm is read as XPM
+ */
+
+int	decode_texture(char *buf, size_t size, t_tex_entry *e)
+{
+	if (has_file_extension(e->path, ".qoi"))
+		return (decode_qoi((const uint8_t *)buf, size, e));
+	if (has_file_extension(e->path, ".ppm"))
+		return (decode_ppm((const uint8_t *)buf, size, e));
+	return (decode_xpm(buf, e));
+}
+
+/**
+ * @brief Face images in e_direction order
+ */
+
+static void	wall_face_slots(t_game *game, t_image **faces)
+{
+	faces[NORTH] = &game->textures.north;
+	faces[SOUTH] = &game->textures.south;
+	faces[EAST] = &game->textures.east;
+	faces[WEST] = &game->textures.west;
+}
+
+/**
+ * @brief Point every face drawn with e at its current image, or clear
+ * them when e is not resident
+ */
+
+void	set_face_images(t_game *game, t_tex_entry *e)
+{
+	t_image	*faces[4];
+	int		i;
+
+	wall_face_slots(game, faces);
+	i = -1;
+	while (++i < 4)
+	{
+		if (game->textures.face[i] == e)
+		{
+			faces[i]->mlx_ptr = e->mlx_ptr;
+			faces[i]->width = e->width;
+			faces[i]->height = e->height;
+			faces[i]->data = NULL;
+			if (e->mlx_ptr)
+				faces[i]->data = mlx_get_data_addr(e->mlx_ptr,
+						&faces[i]->bits_per_pixel, &faces[i]->line_length,
+						&faces[i]->endian);
+		}
+	}
+}
+
+/**
+ * @brief Destroy every resident wall texture and the residency lock;
+ * workers must already have been joined by finish_texture_decoding
+ */
+
+void	release_texture_entries(t_game *game)
+{
+	t_textures	*t;
+	int			i;
+
+	t = &game->textures;
+	i = -1;
+	while (++i < t->cache_count)
+	{
+		if (t->cache[i].mlx_ptr)
+			mlx_destroy_image(game->mlx.instance, t->cache[i].mlx_ptr);
+		t->cache[i].mlx_ptr = NULL;
+		set_face_images(game, &t->cache[i]);
+	}
+	if (t->lock_ready)
+		pthread_mutex_destroy(&t->lock);
+	t->lock_ready = 0;
+}
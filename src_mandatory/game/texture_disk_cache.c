@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_disk_cache.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief FNV-1a over the whole source file, words first then the tail
+ */
+
+uint64_t	hash_texture_source(const char *buf, size_t size)
+{
+	uint64_t	hash;
+	size_t		i;
+
+	hash = cubc_hash(CUBC_HASH_SEED, buf, size & ~(size_t)7);
+	i = size & ~(size_t)7;
+	while (i < size)
+		hash = (hash ^ (unsigned char)buf[i++]) * CUBC_HASH_PRIME;
+	return (hash);
+}
+
+/**
+ * @brief Build $XDG_CACHE_HOME/cub3D/<hash>.bgra (~/.cache by default),
+ * creating the directories on the way
+ * @return 0 when no cache directory can be named
+ */
+
+static int	texture_blob_path(char *out, uint64_t hash)
+{
+	size_t	len;
+	int		i;
+
+	out[0] = '\0';
+	if (getenv("XDG_CACHE_HOME") && *getenv("XDG_CACHE_HOME"))
+		ft_strlcat(out, getenv("XDG_CACHE_HOME"), TEX_CACHE_PATH);
+	else if (getenv("HOME") && *getenv("HOME"))
+	{
+		ft_strlcat(out, getenv("HOME"), TEX_CACHE_PATH);
+		ft_strlcat(out, "/.cache", TEX_CACHE_PATH);
+	}
+	if (!out[0])
+		return (0);
+	mkdir(out, 0755);
+	ft_strlcat(out, "/cub3D", TEX_CACHE_PATH);
+	mkdir(out, 0755);
+	len = ft_strlcat(out, "/0123456789abcdef.bgra", TEX_CACHE_PATH);
+	if (len >= TEX_CACHE_PATH)
+		return (0);
+	i = -1;
+	while (++i < 16)
+		out[len - 6 - i] = "0123456789abcdef"[(hash >> (i * 4)) & 15];
+	return (1);
+}
+
+/**
+ * @brief Map the cached pixels for a source hash instead of decoding
+ *
+ * A blob whose header does not match the source (hash, size or pixel
+ * count) is ignored and rewritten after the fresh decode.
+ */
+
+int	load_cached_texture(t_tex_entry *e, uint64_t hash, size_t size)
+{
+	char		path[TEX_CACHE_PATH];
+	t_tex_blob	*b;
+	struct stat	st;
+	int			fd;
+
+	fd = -1;
+	if (texture_blob_path(path, hash))
+		fd = open(path, O_RDONLY);
+	b = MAP_FAILED;
+	if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(*b))
+		b = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (fd >= 0)
+		close(fd);
+	if (b == MAP_FAILED)
+		return (0);
+	if (b->magic != TEX_BLOB_MAGIC || b->version != TEX_BLOB_VERSION
+		|| b->source_hash != hash || b->source_size != size
+		|| b->width < 1 || b->height < 1 || b->width > TEXTURE_MAX_SIDE
+		|| b->height > TEXTURE_MAX_SIDE || (size_t)st.st_size != sizeof(*b)
+		+ (size_t)b->width * b->height * sizeof(uint32_t))
+		return (munmap(b, st.st_size), 0);
+	e->blob = b;
+	e->blob_size = st.st_size;
+	e->pixels = (uint32_t *)(b + 1);
+	return (e->width = b->width, e->height = b->height, 1);
+}
+
+/**
+ * @brief Write freshly decoded pixels to the cache through a temporary
+ * file renamed into place, so readers never see a partial blob
+ */
+
+void	store_cached_texture(t_tex_entry *e, uint64_t hash, size_t size)
+{
+	char		path[TEX_CACHE_PATH];
+	char		tmp[TEX_CACHE_PATH + 8];
+	t_tex_blob	b;
+	size_t		n;
+	int			fd;
+
+	if (!texture_blob_path(path, hash))
+		return ;
+	ft_strlcpy(tmp, path, sizeof(tmp));
+	ft_strlcat(tmp, ".XXXXXX", sizeof(tmp));
+	fd = mkstemp(tmp);
+	if (fd < 0)
+		return ;
+	ft_bzero(&b, sizeof(b));
+	b.magic = TEX_BLOB_MAGIC;
+	b.version = TEX_BLOB_VERSION;
+	b.width = e->width;
+	b.height = e->height;
+	b.source_hash = hash;
+	b.source_size = size;
+	n = (size_t)e->width * e->height * sizeof(uint32_t);
+	n = (write(fd, &b, sizeof(b)) == sizeof(b)
+			&& write(fd, e->pixels, n) == (ssize_t)n);
+	if (close(fd) != 0 || !n || rename(tmp, path) != 0)
+		unlink(tmp);
+}
+
+void	release_texture_pixels(t_tex_entry *e)
+{
+	if (e->blob)
+		munmap(e->blob, e->blob_size);
+	else
+		free(e->pixels);
+	e->blob = NULL;
+	e->pixels = NULL;
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_loader.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+static char	*read_texture_file(const char *path, size_t *size)
+{
+	struct stat	st;
+	char		*buf;
+	ssize_t		got;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (NULL);
+	buf = NULL;
+	if (fstat(fd, &st) == 0 && st.st_size > 0)
+		buf = malloc((size_t)st.st_size + 1);
+	*size = 0;
+	got = 1;
+	while (buf && got > 0 && *size < (size_t)st.st_size)
+	{
+		got = read(fd, buf + *size, (size_t)st.st_size - *size);
+		if (got > 0)
+			*size += got;
+	}
+	close(fd);
+	if (buf && *size == (size_t)st.st_size)
+		return (buf[*size] = '\0', buf);
+	free(buf);
+	return (NULL);
+}
+
+/**
+ * @brief Map the decoded pixels from the disk cache when the source's
+ * hash has a blob there; otherwise decode and store them for next time
+ */
+
+static void	*texture_decode_main(void *arg)
+{
+	t_tex_entry	*e;
+	uint64_t	hash;
+	size_t		size;
+	char		*buf;
+
+	e = arg;
+	buf = read_texture_file(e->path, &size);
+	if (buf)
+	{
+		hash = hash_texture_source(buf, size);
+		if (!(e->disk_cache && load_cached_texture(e, hash, size))
+			&& decode_texture(buf, size, e) && e->disk_cache)
+			store_cached_texture(e, hash, size);
+	}
+	free(buf);
+	pthread_mutex_lock(e->lock);
+	e->ready = 1;
+	pthread_mutex_unlock(e->lock);
+	return (NULL);
+}
+
+/**
+ * @brief Start decoding a texture the renderer has just asked for
+ *
+ * update_texture_residency picks the result up once ready is set; if no
+ * thread can be started the file is decoded right here instead.
+ */
+
+void	request_texture_entry(t_tex_entry *e)
+{
+	e->requested_us = get_time_us();
+	e->pending = 1;
+	e->decoding = !pthread_create(&e->thread, NULL, texture_decode_main, e);
+	if (!e->decoding)
+		texture_decode_main(e);
+}
+
+/**
+ * @brief Turn a finished cache entry into an MLX image: join its worker,
+ * copy the pixels row by row, and fall back to mlx_xpm_file_to_image
+ * for files the in-tree decoders refuse
+ */
+
+void	upload_texture_entry(t_game *game, t_tex_entry *e)
+{
+	t_image	img;
+	int		y;
+
+	if (e->decoding)
+		pthread_join(e->thread, NULL);
+	e->pending = 0;
+	e->decoding = 0;
+	e->ready = 0;
+	if (!e->pixels)
+	{
+		e->mlx_ptr = mlx_xpm_file_to_image(game->mlx.instance, e->path,
+				&e->width, &e->height);
+		return ;
+	}
+	e->mlx_ptr = mlx_new_image(game->mlx.instance, e->width, e->height);
+	if (e->mlx_ptr)
+		img.data = mlx_get_data_addr(e->mlx_ptr, &img.bits_per_pixel,
+				&img.line_length, &img.endian);
+	y = -1;
+	while (e->mlx_ptr && ++y < e->height)
+		ft_memcpy(img.data + (size_t)y * img.line_length,
+			e->pixels + (size_t)y * e->width, e->width * sizeof(uint32_t));
+	release_texture_pixels(e);
+}
+
+/**
+ * @brief Join any worker still running and drop undelivered pixels;
+ * called before the texture paths the workers read are freed
+ */
+
+void	finish_texture_decoding(t_game *game)
+{
+	t_tex_entry	*e;
+	int			i;
+
+	i = -1;
+	while (++i < game->textures.cache_count)
+	{
+		e = &game->textures.cache[i];
+		if (e->decoding)
+			pthread_join(e->thread, NULL);
+		e->pending = 0;
+		e->decoding = 0;
+		e->ready = 0;
+		release_texture_pixels(e);
+	}
+}
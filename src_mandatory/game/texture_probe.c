@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_probe.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Read the first TEXTURE_PROBE_BYTES of a texture, NUL-terminated,
+ * and the size of the whole file
+ * @return The bytes read, or -1 if path is not a readable regular file
+ */
+
+static ssize_t	read_texture_head(const char *path, char *head, size_t *size)
+{
+	struct stat	st;
+	ssize_t		got;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	got = -1;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+	{
+		*size = st.st_size;
+		got = read(fd, head, TEXTURE_PROBE_BYTES);
+	}
+	close(fd);
+	if (got >= 0)
+		head[got] = '\0';
+	return (got);
+}
+
+/**
+ * @brief Read the XPM values line (width, height, colours, characters
+ * per pixel) into hdr; files the in-tree decoder refuses may still pass,
+ * since MLX decodes those
+ */
+
+int	probe_xpm(char **cursor, int *hdr)
+{
+	char	*line;
+	int		i;
+
+	line = next_xpm_string(cursor);
+	i = -1;
+	while (line && ++i < 4)
+	{
+		while (*line == ' ' || *line == '\t')
+			line++;
+		hdr[i] = ft_atoi(line);
+		while (ft_isdigit(*line))
+			line++;
+	}
+	return (line && hdr[0] >= 1 && hdr[1] >= 1 && hdr[0] <= TEXTURE_MAX_SIDE
+		&& hdr[1] <= TEXTURE_MAX_SIDE && hdr[2] >= 1 && hdr[3] >= 1);
+}
+
+/**
+ * @brief Check a texture without decoding it: the file must open and
+ * its header must pass the probe of the decoder its extension names; a
+ * PPM must also be long enough for the samples its header promises.
+ * Run for every texture before the window opens, so a bad path fails at
+ * startup even though the pixels are only decoded on first sight.
+ */
+
+int	probe_texture_file(t_tex_entry *e)
+{
+	char	head[TEXTURE_PROBE_BYTES + 1];
+	char	*cursor;
+	int		hdr[4];
+	ssize_t	got;
+	size_t	size;
+
+	got = read_texture_head(e->path, head, &size);
+	if (got < 0)
+		return (0);
+	if (has_file_extension(e->path, ".qoi"))
+		return (probe_qoi((const uint8_t *)head, got, e));
+	if (has_file_extension(e->path, ".ppm"))
+	{
+		got = probe_ppm((const uint8_t *)head, got, hdr);
+		return (got && size - got >= (size_t)hdr[0] * hdr[1] * 3
+			* (1 + (hdr[2] > 255)));
+	}
+	cursor = head;
+	return (probe_xpm(&cursor, hdr));
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   texture_residency.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Mean colour of a resident texture, ignoring transparent pixels
+ */
+
+static int	average_texture_color(t_tex_entry *e)
+{
+	t_image		img;
+	uint64_t	sum[4];
+	uint32_t	px;
+	int			i;
+
+	img.data = mlx_get_data_addr(e->mlx_ptr, &img.bits_per_pixel,
+			&img.line_length, &img.endian);
+	ft_bzero(sum, sizeof(sum));
+	i = -1;
+	while (++i < e->width * e->height)
+	{
+		px = *(uint32_t *)(img.data + (size_t)(i / e->width)
+				* img.line_length + (i % e->width) * (img.bits_per_pixel / 8));
+		if (!(px >> 24))
+		{
+			sum[0] += px >> 16 & 0xFF;
+			sum[1] += px >> 8 & 0xFF;
+			sum[2] += px & 0xFF;
+			sum[3]++;
+		}
+	}
+	if (!sum[3])
+		return (TEXTURE_PLACEHOLDER);
+	return (sum[0] / sum[3] << 16 | sum[1] / sum[3] << 8 | sum[2] / sum[3]);
+}
+
+/**
+ * @brief Make a finished texture resident and report how long it took
+ * from the first column that asked for it
+ */
+
+static void	load_texture_entry(t_game *game, t_tex_entry *e)
+{
+	t_textures	*t;
+
+	t = &game->textures;
+	upload_texture_entry(game, e);
+	if (!e->mlx_ptr)
+		handle_game_error(game, "Error\nFailed to load texture file\n");
+	t->resident += (size_t)e->width * e->height * sizeof(uint32_t);
+	e->average = average_texture_color(e);
+	set_face_images(game, e);
+	record_texture_phase(game, e);
+	printf("Texture %s loaded %dx%d in %.1f ms, %zu KiB resident\n",
+		e->path, e->width, e->height,
+		(get_time_us() - e->requested_us) / 1000.0, t->resident / 1024);
+}
+
+/**
+ * @brief Evict the textures seen longest ago until the resident set fits
+ * the budget
+ *
+ * Anything drawn in the last frame is kept even over budget, so a view
+ * needing more than the budget does not reload a texture every frame.
+ */
+
+static void	trim_texture_residency(t_game *game)
+{
+	t_textures	*t;
+	t_tex_entry	*victim;
+	int			i;
+
+	t = &game->textures;
+	while (t->resident > t->budget)
+	{
+		victim = NULL;
+		i = -1;
+		while (++i < t->cache_count)
+			if (t->cache[i].mlx_ptr && t->cache[i].last_used + 1 < t->frame
+				&& (!victim || t->cache[i].last_used < victim->last_used))
+				victim = &t->cache[i];
+		if (!victim)
+			return ;
+		mlx_destroy_image(game->mlx.instance, victim->mlx_ptr);
+		victim->mlx_ptr = NULL;
+		set_face_images(game, victim);
+		t->resident -= (size_t)victim->width * victim->height
+			* sizeof(uint32_t);
+		printf("Texture %s evicted, %zu KiB resident\n", victim->path,
+			t->resident / 1024);
+	}
+}
+
+/**
+ * @brief Called by each wall column before it samples a face
+ * @return 1 if the face's texture is resident; otherwise its decode is
+ * started (once) and the column should be drawn in its average colour
+ */
+
+int	wall_texture_ready(t_game *game, int face)
+{
+	t_tex_entry	*e;
+
+	e = game->textures.face[face];
+	e->last_used = game->textures.frame;
+	if (e->mlx_ptr)
+		return (1);
+	if (!e->pending)
+		request_texture_entry(e);
+	game->textures.flat_columns++;
+	return (0);
+}
+
+/**
+ * @brief Upload the textures whose decode finished since the last frame,
+ * then trim the resident set back to the budget
+ */
+
+void	update_texture_residency(t_game *game)
+{
+	t_textures	*t;
+	int			ready;
+	int			i;
+
+	t = &game->textures;
+	t->frame++;
+	t->flat_columns = 0;
+	i = -1;
+	while (++i < t->cache_count)
+	{
+		ready = 0;
+		pthread_mutex_lock(&t->lock);
+		if (t->cache[i].pending)
+			ready = t->cache[i].ready;
+		pthread_mutex_unlock(&t->lock);
+		if (ready)
+			load_texture_entry(game, &t->cache[i]);
+	}
+	trim_texture_residency(game);
+}
@@ -20,19 +20,23 @@ static void	init_mlx(t_game *game)
 	game->mlx.height = 0;
 }
 
+/**
+ * @brief Zero every map pointer and counter, then set the fields whose
+ * empty state is not 0
+ */
+
 static void	init_map(t_game *game)
 {
-	game->map.grid = NULL;
-	game->map.width = 0;
-	game->map.height = 0;
+	ft_bzero(&game->map, sizeof(game->map));
 	game->map.floor_rgb[0] = -1;
 	game->map.floor_rgb[1] = -1;
 	game->map.floor_rgb[2] = -1;
 	game->map.ceiling_rgb[0] = -1;
 	game->map.ceiling_rgb[1] = -1;
 	game->map.ceiling_rgb[2] = -1;
-	game->map.current_line = NULL;
-	game->map.data_buffer = NULL;
+	game->map.rows_closed = 1;
+	game->map.threads = MAP_THREADS;
+	game->map.chunk_budget = MAP_CHUNK_BUDGET;
 }
 
 static void	init_player(t_game *game)
@@ -46,6 +50,7 @@ static void	init_player(t_game *game)
 	game->player.initial_dir = '\0';
 	game->player.move_speed = 0.0;
 	game->player.rotate_speed = 0.0;
+	game->player.mouse_sensitivity = MOUSE_SENSITIVITY;
 }
 
 static void	init_textures(t_game *game)
@@ -60,6 +65,12 @@ static void	init_textures(t_game *game)
 	game->textures.west.path = NULL;
 	game->textures.screen.mlx_ptr = NULL;
 	game->textures.screen.path = NULL;
+	game->textures.cache_count = 0;
+	game->textures.disk_cache = 1;
+	game->textures.lock_ready = 0;
+	game->textures.budget = TEXTURE_BUDGET;
+	game->textures.resident = 0;
+	game->textures.frame = 0;
 }
 
 void	init_game_structure(t_game *game)
@@ -68,4 +79,9 @@ void	init_game_structure(t_game *game)
 	init_map(game);
 	init_player(game);
 	init_textures(game);
+	ft_bzero(&game->startup, sizeof(game->startup));
+	ft_bzero(&game->input, sizeof(game->input));
+	ft_bzero(&game->session, sizeof(game->session));
+	ft_bzero(&game->sim, sizeof(game->sim));
+	ft_bzero(&game->view, sizeof(game->view));
 }
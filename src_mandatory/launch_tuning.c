@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   launch_tuning.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Read an unsigned decimal no larger than limit
+ * @return 1, or -1 when s is empty, not a number or too large
+ */
+
+static int	parse_count(const char *s, size_t limit, size_t *value)
+{
+	int	i;
+
+	*value = 0;
+	i = 0;
+	while (ft_isdigit(s[i]) && *value <= (limit - (s[i] - '0')) / 10)
+		*value = *value * 10 + s[i++] - '0';
+	if (i == 0 || s[i])
+		return (-1);
+	return (1);
+}
+
+/**
+ * @brief Read a size given in KiB into bytes
+ * @return 1, or -1 on a bad value
+ */
+
+static int	parse_kib(const char *s, size_t *bytes)
+{
+	size_t	value;
+
+	if (parse_count(s, SIZE_MAX / 1024, &value) < 0)
+		return (-1);
+	*bytes = value * 1024;
+	return (1);
+}
+
+/**
+ * @brief --texture-budget=<KiB> caps the decoded texture cache,
+ * --chunk-budget=<KiB> caps the compiled map chunks kept resident,
+ * --map-threads=<n> sets how many bands validate the map (0 picks one per
+ * online CPU)
+ * @return 1 if arg was one of these, 0 if not, -1 on a bad value
+ */
+
+int	apply_tuning_option(t_game *game, char *arg)
+{
+	size_t	value;
+
+	if (!ft_strncmp(arg, "--texture-budget=", 17))
+		return (parse_kib(arg + 17, &game->textures.budget));
+	if (!ft_strncmp(arg, "--chunk-budget=", 15))
+		return (parse_kib(arg + 15, &game->map.chunk_budget));
+	if (ft_strncmp(arg, "--map-threads=", 14))
+		return (0);
+	if (parse_count(arg + 14, MAP_MAX_THREADS, &value) < 0)
+		return (-1);
+	game->map.threads = value;
+	return (1);
+}
+
+/**
+ * @brief Take a leading --map-threads=<n> off the --validate file list
+ * and hand the rest to batch
+ *
+ * n, or one per online CPU when it is 0, is the thread budget: it sizes
+ * the worker pool, and when there are fewer maps than threads the rest
+ * are split between the maps as validation bands.
+ * @return 1, or 0 on a bad value
+ */
+
+int	parse_batch_threads(t_batch *batch, int *count, char ***files)
+{
+	size_t	value;
+	long	budget;
+
+	value = MAP_THREADS;
+	if (*count > 0 && !ft_strncmp((*files)[0], "--map-threads=", 14))
+	{
+		if (parse_count((*files)[0] + 14, MAP_MAX_THREADS, &value) < 0)
+			return (0);
+		(*files)++;
+		(*count)--;
+	}
+	batch->files = *files;
+	batch->count = *count;
+	budget = value;
+	if (budget < 1)
+		budget = sysconf(_SC_NPROCESSORS_ONLN);
+	if (budget > MAP_MAX_THREADS)
+		budget = MAP_MAX_THREADS;
+	if (budget < 1)
+		budget = 1;
+	batch->workers = budget;
+	if (batch->workers > *count && *count > 0)
+		batch->workers = *count;
+	batch->map_threads = budget / batch->workers;
+	return (1);
+}
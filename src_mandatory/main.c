@@ -12,38 +12,41 @@
 
 #include "../includes_mandatory/cub3d.h"
 
-int	parse_map_file(t_game *game, int file_descriptor)
+static int	run_game(t_game *game, char *path)
 {
-	if (!read_and_parse_map_file(file_descriptor, game))
-		return (0);
-	normalize_map_dimensions(game);
-	if (!validate_parsed_map(game))
-		return (0);
-	close(file_descriptor);
-	return (1);
-}
-
-int	main(int argc, char **argv)
-{
-	t_game	game;
-	int		fd;
+	int	fd;
 
-	if (!validate_arguments(argc, argv))
-		return (1);
-	if (!validate_input_file(argv[1]))
+	if (!validate_input_file(path))
 		return (2);
-	fd = open(argv[1], O_RDONLY);
+	record_startup_phase(game, "check input");
+	fd = open(path, O_RDONLY);
 	if (!is_valid_file_descriptor(fd))
 		return (3);
-	init_game_structure(&game);
-	if (!is_parseable_map_file(&game, fd))
+	record_startup_phase(game, "open");
+	if (!is_parseable_map_file(game, fd))
 		return (4);
 	close(fd);
-	if (init_game_engine(&game) != 0)
+	if (init_game_engine(game) != 0)
 	{
 		printf("Error\nGame engine initialization failed\n");
-		free_string_array(game.map.grid);
+		cleanup_parsing_error(game);
 		return (5);
 	}
 	return (0);
 }
+
+int	main(int argc, char **argv)
+{
+	t_game	game;
+
+	if (argc > 1 && !ft_strcmp(argv[1], "--validate"))
+		return (run_batch_validation(argc - 2, argv + 2));
+	if (argc > 1 && !ft_strcmp(argv[1], "--compile"))
+		return (compile_map_file(argc - 2, argv + 2));
+	init_game_structure(&game);
+	game.start_us = get_time_us();
+	if (!parse_launch_options(&game, &argc, &argv)
+		|| !validate_arguments(argc, argv) || !open_session(&game))
+		return (1);
+	return (run_game(&game, argv[1]));
+}
@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_compiler.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Write the compiled map to args[1] and report it, removing the
+ * file again on failure
+ */
+
+static int	save_compiled_map(t_game *game, char **args, long long start)
+{
+	int	fd;
+	int	ok;
+
+	fd = open(args[1], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	ok = (fd >= 0 && write_compiled_map(game, fd));
+	if (fd >= 0 && close(fd) < 0)
+		ok = 0;
+	if (!ok)
+	{
+		unlink(args[1]);
+		printf("Error\nCannot write compiled map: %s\n", args[1]);
+		return (0);
+	}
+	printf("Compiled %s (%dx%d) to %s in %.1f ms\n", args[0],
+		game->map.width, game->map.height, args[1],
+		(get_time_us() - start) / 1000.0);
+	return (1);
+}
+
+/**
+ * @brief --compile in.cub out.cubc: parse and validate once, then store
+ * the result in the binary format load_compiled_map uses directly
+ *
+ * Parse errors exit through handle_parsing_error exactly as a normal
+ * launch would. A map that fails the closure check is not written, since
+ * loading the .cubc trusts its validated flag.
+ */
+
+int	compile_map_file(int count, char **args)
+{
+	t_game		game;
+	int			fd;
+	int			ok;
+	long long	start;
+
+	if (count != 2 || !has_file_extension(args[0], ".cub")
+		|| !has_file_extension(args[1], ".cubc"))
+		return (printf("Error\nUsage: --compile <map_file.cub> "
+				"<map_file.cubc>\n"), 1);
+	fd = open(args[0], O_RDONLY);
+	if (fd < 0)
+		return (printf("Error\n%s: %s\n", ERR_FILE_OPEN, args[0]), 1);
+	start = get_time_us();
+	init_game_structure(&game);
+	read_and_parse_map_file(fd, &game);
+	close(fd);
+	normalize_map_dimensions(&game);
+	ok = validate_parsed_map(&game);
+	if (ok)
+		build_wall_bitmap(&game);
+	if (ok)
+		ok = save_compiled_map(&game, args, start);
+	cleanup_parsing_error(&game);
+	return (!ok);
+}
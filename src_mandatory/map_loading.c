@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_loading.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Load the map on fd, compiled or text, validate it and build the
+ * lookup structures the game reads it through
+ * @return 1 on success, 0 when the text map failed to parse or validate
+ */
+
+int	parse_map_file(t_game *game, int file_descriptor)
+{
+	long long	stamps[4];
+	int			compiled;
+
+	stamps[0] = get_time_us();
+	compiled = load_compiled_map(game, file_descriptor);
+	if (!compiled && !read_and_parse_map_file(file_descriptor, game))
+		return (0);
+	record_startup_phase(game, "parse");
+	if (!compiled)
+		normalize_map_dimensions(game);
+	stamps[1] = record_startup_phase(game, "normalize");
+	if (!compiled && !validate_parsed_map(game))
+		return (0);
+	arena_release(&game->map.arena);
+	stamps[2] = record_startup_phase(game, "validate");
+	build_wall_bitmap(game);
+	build_distance_field(game);
+	start_chunk_pager(&game->map, game->player.pos_x, game->player.pos_y);
+	stamps[3] = record_startup_phase(game, "acceleration");
+	print_map_load_report(game, stamps);
+	return (1);
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   chunk_lru.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief LRU of the chunks the pager keeps resident
+ *
+ * Only the pager thread uses these lists. A chunk costs its 4 KiB block
+ * of chars plus 512 bytes of wall bits; a bitmap page is shared by 8
+ * consecutive chunks and is dropped once none of them is admitted.
+ */
+
+static void	unlink_chunk(t_pager *p, int c)
+{
+	if (p->prev[c] >= 0)
+		p->next[p->prev[c]] = p->next[c];
+	else
+		p->head = p->next[c];
+	if (p->next[c] >= 0)
+		p->prev[p->next[c]] = p->prev[c];
+	else
+		p->tail = p->prev[c];
+}
+
+/**
+ * @brief Move a chunk to the front of the LRU, asking the kernel to read
+ * it ahead when it was not admitted yet
+ */
+
+static void	touch_chunk(t_map *map, int c)
+{
+	t_pager	*p;
+
+	p = &map->pager;
+	if (p->admitted[c])
+		unlink_chunk(p, c);
+	else
+	{
+		p->admitted[c] = 1;
+		p->count++;
+		advise_range(map->chunk_cells + (size_t)c * CHUNK_BYTES, CHUNK_BYTES,
+			MADV_WILLNEED);
+		advise_range((char *)map->wall_bits + ((size_t)(c >> 3) << 12),
+			CHUNK_BYTES, MADV_WILLNEED);
+	}
+	p->prev[c] = -1;
+	p->next[c] = p->head;
+	if (p->head >= 0)
+		p->prev[p->head] = c;
+	p->head = c;
+	if (p->tail < 0)
+		p->tail = c;
+}
+
+void	admit_chunk_window(t_map *map, int cx, int cy)
+{
+	int	x;
+	int	y;
+
+	y = cy - MAP_CHUNK_RADIUS - 1;
+	while (++y <= cy + MAP_CHUNK_RADIUS)
+	{
+		x = cx - MAP_CHUNK_RADIUS - 1;
+		while (++x <= cx + MAP_CHUNK_RADIUS)
+		{
+			if (x >= 0 && y >= 0 && x < map->macros_w && y < map->macros_h)
+				touch_chunk(map, y * map->macros_w + x);
+		}
+	}
+}
+
+/**
+ * @brief Release every 4 KiB block of a section whose chunks are all
+ * unadmitted, merging neighbouring blocks into one call so that larger host
+ * pages still get dropped
+ */
+
+static void	drop_section(char *base, t_pager *p, size_t chunks, size_t step)
+{
+	size_t	page;
+	size_t	start;
+	size_t	c;
+	int		keep;
+
+	start = 0;
+	page = 0;
+	while (page * step < chunks)
+	{
+		keep = 0;
+		c = page * step;
+		while (!keep && c < chunks && c < (page + 1) * step)
+			keep = p->admitted[c++];
+		if (keep && page > start)
+			advise_range(base + start * CHUNK_BYTES,
+				(page - start) * CHUNK_BYTES, MADV_DONTNEED);
+		if (keep)
+			start = page + 1;
+		page++;
+	}
+	if (page > start)
+		advise_range(base + start * CHUNK_BYTES, (page - start) * CHUNK_BYTES,
+			MADV_DONTNEED);
+}
+
+/**
+ * @brief Evict least recently used chunks down to the budget, then drop
+ * every page outside the admitted set
+ *
+ * The mapping is private and never written, so a dropped page is simply
+ * read back from the file if a far ray touches it again.
+ */
+
+void	trim_chunk_pages(t_map *map)
+{
+	t_pager	*p;
+	size_t	chunks;
+	int		c;
+
+	p = &map->pager;
+	while (p->count > p->budget && p->tail >= 0)
+	{
+		c = p->tail;
+		unlink_chunk(p, c);
+		p->admitted[c] = 0;
+		p->count--;
+	}
+	chunks = (size_t)map->macros_w * map->macros_h;
+	drop_section(map->chunk_cells, p, chunks, 1);
+	drop_section((char *)map->wall_bits, p, chunks,
+		CHUNK_BYTES / CHUNK_BITS_BYTES);
+}
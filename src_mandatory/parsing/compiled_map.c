@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compiled_map.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief FNV-1a over 64-bit words; size is always a multiple of 8
+ */
+
+uint64_t	cubc_hash(uint64_t hash, const void *data, size_t size)
+{
+	const uint64_t	*words;
+	size_t			i;
+
+	words = data;
+	i = 0;
+	while (i < size / 8)
+	{
+		hash = (hash ^ words[i]) * CUBC_HASH_PRIME;
+		i++;
+	}
+	return (hash);
+}
+
+/**
+ * @brief Check that every section the header points at fits the file
+ * and agrees with the map size; the checksum is verified separately
+ */
+
+static int	is_valid_cubc_layout(const t_cubc_header *h, size_t size)
+{
+	uint64_t	chunks;
+
+	if (h->file_size != size || !(h->flags & CUBC_VALIDATED))
+		return (0);
+	if (h->width < 1 || h->height < 1 || h->width > (1U << 30)
+		|| h->height > (1U << 30)
+		|| h->chunks_w != (h->width + 63) >> 6
+		|| h->chunks_h != (h->height + 63) >> 6)
+		return (0);
+	chunks = (uint64_t)h->chunks_w * h->chunks_h;
+	if (h->grid_offset < sizeof(*h) || h->grid_offset % CHUNK_BYTES
+		|| h->bits_offset != h->grid_offset + chunks * CHUNK_BYTES
+		|| h->macro_offset != h->bits_offset + chunks * CHUNK_BITS_BYTES
+		|| h->file_size != h->macro_offset + chunks * sizeof(uint64_t))
+		return (0);
+	return (h->player_x < h->width && h->player_y < h->height
+		&& is_character_valid(h->player_dir, "NSEW"));
+}
+
+/**
+ * @brief Copy the texture paths, colors and player start out of the header
+ */
+
+static void	attach_compiled_config(t_game *g, char *data, t_cubc_header *h)
+{
+	char	**slots[4];
+	int		i;
+
+	texture_path_slots(g, slots);
+	i = -1;
+	while (++i < 4)
+	{
+		if (h->texture_offsets[i] < sizeof(*h) || h->texture_offsets[i]
+			>= h->grid_offset || !ft_memchr(data + h->texture_offsets[i],
+				'\0', h->grid_offset - h->texture_offsets[i]))
+			handle_parsing_error(g, ERR_CUBC);
+		*slots[i] = ft_strdup(data + h->texture_offsets[i]);
+		if (!*slots[i])
+			handle_parsing_error(g, ERR_MALLOC);
+	}
+	i = -1;
+	while (++i < 3)
+	{
+		g->map.floor_rgb[i] = h->floor_rgb[i];
+		g->map.ceiling_rgb[i] = h->ceiling_rgb[i];
+	}
+	set_player_position(g, h->player_dir, h->player_y, h->player_x);
+}
+
+/**
+ * @brief Verify the checksum slice by slice, releasing each slice once it
+ * is hashed so loading never holds more than CUBC_HASH_SLICE of the file
+ *
+ * The mapping is private and never written, so dropped pages are read
+ * back from the file when the renderer or the chunk pager needs them.
+ */
+
+static int	is_valid_cubc_checksum(char *data, size_t size, t_cubc_header h)
+{
+	uint64_t	hash;
+	size_t		done;
+	size_t		end;
+
+	hash = CUBC_HASH_SEED;
+	done = sizeof(h);
+	madvise(data, size, MADV_SEQUENTIAL);
+	while (done < size)
+	{
+		end = (done / CUBC_HASH_SLICE + 1) * CUBC_HASH_SLICE;
+		if (end > size)
+			end = size;
+		hash = cubc_hash(hash, data + done, end - done);
+		advise_range(data + done / CUBC_HASH_SLICE * CUBC_HASH_SLICE,
+			end - done / CUBC_HASH_SLICE * CUBC_HASH_SLICE, MADV_DONTNEED);
+		done = end;
+	}
+	madvise(data, size, MADV_NORMAL);
+	h.checksum = 0;
+	hash = cubc_hash(hash, &h, sizeof(h));
+	return (hash == ((t_cubc_header *)data)->checksum);
+}
+
+/**
+ * @brief Load fd as a compiled map when it starts with the .cubc magic
+ *
+ * Text parsing is skipped; the checksum guards against corruption and
+ * check_compiled_grid repeats the map validation on the stored grid, so
+ * a file edited and re-hashed by hand cannot bring in an open map.
+ * The format is little-endian, like every host this builds on, so a
+ * magic that reads byte-swapped is refused, as the sections are used
+ * in place.
+ * The file stays mapped until exit: the grid chunks and both bitmap
+ * levels are used in place, paged in on demand and trimmed by the pager.
+ * @return 1 if a compiled map was loaded, 0 if fd holds a text .cub
+ */
+
+int	load_compiled_map(t_game *game, int fd)
+{
+	t_cubc_header	h;
+	uint32_t		magic;
+
+	if (pread(fd, &magic, sizeof(magic), 0) != sizeof(magic)
+		|| (magic != CUBC_MAGIC && magic != CUBC_MAGIC_SWAPPED))
+		return (0);
+	if (magic != CUBC_MAGIC)
+		handle_parsing_error(game, ERR_CUBC_BYTE_ORDER);
+	if (!map_cub_file(fd, &game->map) || game->map.file_size < sizeof(h))
+		handle_parsing_error(game, ERR_CUBC);
+	ft_memcpy(&h, game->map.file_data, sizeof(h));
+	if (h.version != CUBC_VERSION)
+		handle_parsing_error(game, ERR_CUBC_VERSION);
+	if (!is_valid_cubc_layout(&h, game->map.file_size)
+		|| !is_valid_cubc_checksum(game->map.file_data, game->map.file_size, h))
+		handle_parsing_error(game, ERR_CUBC);
+	game->map.compiled = 1;
+	game->map.height = h.height;
+	game->map.width = h.width;
+	game->map.chunk_cells = game->map.file_data + h.grid_offset;
+	game->map.wall_bits = (uint64_t *)(game->map.file_data + h.bits_offset);
+	game->map.macro_bits = (uint64_t *)(game->map.file_data + h.macro_offset);
+	check_compiled_grid(game, &h);
+	attach_compiled_config(game, game->map.file_data, &h);
+	return (1);
+}
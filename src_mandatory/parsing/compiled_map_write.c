@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compiled_map_write.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Size and place every section and copy the map shape and player
+ * start; flags, colors and the checksum are filled in by the caller
+ */
+
+static void	fill_cubc_header(t_game *g, t_cubc_header *h, char ***slots)
+{
+	uint64_t	offset;
+	int			i;
+
+	ft_bzero(h, sizeof(*h));
+	h->magic = CUBC_MAGIC;
+	h->version = CUBC_VERSION;
+	h->width = g->map.width;
+	h->height = g->map.height;
+	h->chunks_w = g->map.macros_w;
+	h->chunks_h = g->map.macros_h;
+	h->player_x = (uint32_t)g->player.pos_x;
+	h->player_y = (uint32_t)g->player.pos_y;
+	h->player_dir = g->player.initial_dir;
+	offset = sizeof(*h);
+	i = -1;
+	while (++i < 4)
+	{
+		h->texture_offsets[i] = offset;
+		offset += ft_strlen(*slots[i]) + 1;
+	}
+	h->grid_offset = (offset + CHUNK_BYTES - 1) & ~(uint64_t)(CHUNK_BYTES - 1);
+	offset = (uint64_t)h->chunks_w * h->chunks_h;
+	h->bits_offset = h->grid_offset + offset * CHUNK_BYTES;
+	h->macro_offset = h->bits_offset + offset * CHUNK_BITS_BYTES;
+	h->file_size = h->macro_offset + offset * sizeof(uint64_t);
+}
+
+static int	write_hashed(int fd, const void *data, size_t size,
+		uint64_t *hash)
+{
+	*hash = cubc_hash(*hash, data, size);
+	return (write(fd, data, size) == (ssize_t)size);
+}
+
+static int	write_cubc_strings(int fd, t_cubc_header *h, char ***slots,
+		uint64_t *hash)
+{
+	char	*block;
+	size_t	size;
+	int		ok;
+	int		i;
+
+	size = h->grid_offset - sizeof(*h);
+	block = ft_calloc(size, 1);
+	if (!block)
+		return (0);
+	i = -1;
+	while (++i < 4)
+		ft_memcpy(block + h->texture_offsets[i] - sizeof(*h), *slots[i],
+			ft_strlen(*slots[i]) + 1);
+	ok = write_hashed(fd, block, size, hash);
+	free(block);
+	return (ok);
+}
+
+/**
+ * @brief Write the grid one row of chunks at a time, each chunk being
+ * 64 rows of 64 chars and space-padded past the map edge
+ */
+
+static int	write_cubc_grid(int fd, t_map *map, uint64_t *hash)
+{
+	char	*band;
+	size_t	size;
+	int		ok;
+	int		y;
+	int		x;
+
+	size = (size_t)map->macros_w * CHUNK_BYTES;
+	band = malloc(size);
+	if (!band)
+		return (0);
+	ok = 1;
+	y = 0;
+	while (ok && y < map->height)
+	{
+		if ((y & 63) == 0)
+			ft_memset(band, ' ', size);
+		x = -1;
+		while (++x < map->width)
+			band[((x >> 6) << 12) | ((y & 63) << 6) | (x & 63)]
+				= map->grid[y][x];
+		if ((++y & 63) == 0 || y == map->height)
+			ok = write_hashed(fd, band, size, hash);
+	}
+	free(band);
+	return (ok);
+}
+
+/**
+ * @brief Write the validated map as .cubc (layout in t_cubc_header)
+ *
+ * The body is written first and hashed on the way out; the header goes
+ * last, once the checksum is known.
+ * @return 1 on success, 0 on allocation or write failure
+ */
+
+int	write_compiled_map(t_game *game, int fd)
+{
+	t_cubc_header	h;
+	char			**slots[4];
+	uint64_t		hash;
+	int				i;
+
+	texture_path_slots(game, slots);
+	fill_cubc_header(game, &h, slots);
+	h.flags = CUBC_VALIDATED;
+	i = -1;
+	while (++i < 3)
+	{
+		h.floor_rgb[i] = game->map.floor_rgb[i];
+		h.ceiling_rgb[i] = game->map.ceiling_rgb[i];
+	}
+	hash = CUBC_HASH_SEED;
+	if (lseek(fd, sizeof(h), SEEK_SET) != sizeof(h)
+		|| !write_cubc_strings(fd, &h, slots, &hash)
+		|| !write_cubc_grid(fd, &game->map, &hash)
+		|| !write_hashed(fd, game->map.wall_bits,
+			h.macro_offset - h.bits_offset, &hash)
+		|| !write_hashed(fd, game->map.macro_bits,
+			h.file_size - h.macro_offset, &hash))
+		return (0);
+	h.checksum = cubc_hash(hash, &h, sizeof(h));
+	return (pwrite(fd, &h, sizeof(h), 0) == sizeof(h));
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compiled_row_scan.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief High bit set in every byte of v equal to c, and only there
+ */
+
+static uint64_t	bytes_equal(uint64_t v, char c)
+{
+	uint64_t	t;
+
+	t = v ^ (BYTES_LOW * (uint8_t)c);
+	return (~(((t & ~BYTES_HIGH) + ~BYTES_HIGH) | t) & BYTES_HIGH);
+}
+
+/**
+ * @brief Gather the 64 rows of chunk row cy into slot, reading each chunk
+ * page front to back a word at a time. A row takes stride bytes, reads as
+ * spaces past the map width whatever the file holds there and, with masks
+ * set, is followed by its space mask: one word per eight cells, high bit
+ * set under each space. The chunk row's pages are released once copied,
+ * like the checksum pass does with its slices.
+ */
+
+void	load_compiled_band(t_map *map, int cy, char *slot, int masks)
+{
+	const char	*chunk;
+	size_t		stride;
+	size_t		i;
+	int			cx;
+	int			r;
+
+	stride = (size_t)compiled_row_words(map->width) * 8;
+	chunk = map->chunk_cells + (((size_t)cy * (stride >> 6)) << 12);
+	i = -1;
+	while (++i < (stride >> 6) * 512)
+		*(uint64_t *)(slot + (i >> 3 & 63) * 2 * stride + ((i >> 9) << 6)
+				+ (i & 7) * 8) = ((const uint64_t *)chunk)[i];
+	advise_range((char *)chunk, (stride >> 6) * CHUNK_BYTES, MADV_DONTNEED);
+	r = -1;
+	while (++r < 64)
+	{
+		ft_memset(slot + r * 2 * stride + map->width, ' ',
+			stride - map->width);
+		cx = -1;
+		while (masks && ++cx < (int)(stride >> 3))
+			((uint64_t *)(slot + (r * 2 + 1) * stride))[cx] = bytes_equal(
+					((uint64_t *)(slot + r * 2 * stride))[cx], ' ');
+	}
+}
+
+/**
+ * @brief Take the eight cells from x one by one, as scan_row does, when
+ * they hold more than floor, wall and space: players and bad characters
+ */
+
+static void	scan_rare_bytes(const char *row, int x, t_band *band)
+{
+	int	end;
+
+	end = x + 8;
+	while (x < end)
+	{
+		if (is_character_valid(row[x], "NSEW"))
+		{
+			band->player_dir = row[x];
+			band->player_row = band->first;
+			band->player_col = x;
+			band->players++;
+		}
+		else if (!is_character_valid(row[x], "10 "))
+			band->players++;
+		x++;
+	}
+}
+
+/**
+ * @brief Full check of the eight cells from x; open has a high bit set
+ * under every cell with a space beside, above or below it
+ */
+
+static void	check_word(const char *row, int x, uint64_t open, t_band *band)
+{
+	uint64_t	cells;
+	uint64_t	blocked;
+
+	cells = *(const uint64_t *)(row + x);
+	blocked = bytes_equal(cells, '1') | bytes_equal(cells, ' ');
+	if ((blocked | bytes_equal(cells, '0')) != BYTES_HIGH)
+		scan_rare_bytes(row, x, band);
+	if (~blocked & open & BYTES_HIGH)
+		band->closed = 0;
+}
+
+/**
+ * @brief is_enclosed_row eight cells at a time for row band->first: a
+ * cell that is neither wall nor space must not touch a space, and the
+ * map border reads as space. space holds the masks of the rows above, at
+ * and below it. Words of only floor and wall with no space around them,
+ * nearly all of a large map, cost one compare.
+ */
+
+void	check_compiled_row(const char *row, uint64_t **space, t_band *band)
+{
+	const uint64_t	*cells;
+	uint64_t		open;
+	uint64_t		left;
+	int				words;
+	int				i;
+
+	cells = (const uint64_t *)row;
+	words = compiled_row_words(band->map->width) - 1;
+	left = BYTES_HIGH;
+	i = -1;
+	while (++i < words)
+	{
+		open = (left >> 56) | (space[1][i] << 8) | (space[1][i] >> 8)
+			| (space[1][i + 1] << 56) | space[0][i] | space[2][i];
+		if ((cells[i] | BYTES_LOW) != BYTES_LOW * '1' || open)
+			check_word(row, i << 3, open, band);
+		left = space[1][i];
+	}
+}
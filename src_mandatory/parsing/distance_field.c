@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   distance_field.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Chebyshev distance from every cell to the nearest wall
+ *
+ * Two raster passes of the 8-neighbour chamfer transform give the exact
+ * chessboard distance in O(width * height). A cell at distance d has only
+ * empty cells within d - 1 in x and y, so a ray can leave that square in a
+ * single jump. Cells outside the grid count as walls; values saturate at
+ * 255.
+ */
+
+static int	distance_at(t_map *map, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= map->width || y >= map->height)
+		return (0);
+	return (map->wall_distance[(size_t)y * map->width + x]);
+}
+
+static void	relax_cell(t_map *map, int x, int y, int dir)
+{
+	int				best;
+	int				neighbour;
+	uint8_t			*cell;
+
+	cell = &map->wall_distance[(size_t)y * map->width + x];
+	if (*cell == 0)
+		return ;
+	best = distance_at(map, x - dir, y);
+	neighbour = distance_at(map, x - 1, y - dir);
+	if (neighbour < best)
+		best = neighbour;
+	neighbour = distance_at(map, x, y - dir);
+	if (neighbour < best)
+		best = neighbour;
+	neighbour = distance_at(map, x + 1, y - dir);
+	if (neighbour < best)
+		best = neighbour;
+	if (best + 1 < *cell)
+		*cell = (uint8_t)(best + 1);
+}
+
+static void	seed_distance_field(t_map *map)
+{
+	int	x;
+	int	y;
+
+	y = -1;
+	while (++y < map->height)
+	{
+		x = -1;
+		while (++x < map->width)
+		{
+			if (is_wall_cell(map, x, y))
+				map->wall_distance[(size_t)y * map->width + x] = 0;
+			else
+				map->wall_distance[(size_t)y * map->width + x] = 255;
+		}
+	}
+}
+
+/**
+ * @brief Forward then backward chamfer pass
+ * @return Sum of all distances, for the mean free radius
+ */
+
+static size_t	sweep_distance_field(t_map *map)
+{
+	int		x;
+	int		y;
+	size_t	sum;
+
+	y = -1;
+	while (++y < map->height)
+	{
+		x = -1;
+		while (++x < map->width)
+			relax_cell(map, x, y, 1);
+	}
+	sum = 0;
+	while (--y >= 0)
+	{
+		x = map->width;
+		while (--x >= 0)
+		{
+			relax_cell(map, x, y, -1);
+			sum += map->wall_distance[(size_t)y * map->width + x];
+		}
+	}
+	return (sum);
+}
+
+/**
+ * @brief Build the field, and drop it again on maps too cluttered for
+ * leaping to beat plain stepping (mean distance below DIST_FIELD_MIN_MEAN).
+ * Maps above DIST_FIELD_MAX_CELLS keep the block hierarchy only, so the
+ * field never costs more than 64 MiB.
+ */
+
+void	build_distance_field(t_game *game)
+{
+	t_map	*map;
+	size_t	cells;
+
+	map = &game->map;
+	cells = (size_t)map->width * map->height;
+	if (cells > DIST_FIELD_MAX_CELLS)
+		return ;
+	map->wall_distance = malloc(cells);
+	if (!map->wall_distance)
+		handle_parsing_error(game,
+			"Error\nMemory allocation failed for distance field\n");
+	seed_distance_field(map);
+	if (sweep_distance_field(map) < cells * DIST_FIELD_MIN_MEAN)
+	{
+		free(map->wall_distance);
+		map->wall_distance = NULL;
+	}
+}
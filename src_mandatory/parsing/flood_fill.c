@@ -37,80 +37,50 @@ int	free_double_ptr(char **ptr)
 }
 
 /**
- * Validate the map structure
- * Checks if the map is rectangular, has valid characters, and is closed
- * @param game Pointer to the game structure containing the map
- * @return true if the map is valid, false otherwise
- */
-
-bool	validate_open_walls(t_game *game)
-{
-	char	**temp_map;
-	bool	result;
-
-	temp_map = create_temp_map(&game->map);
-	if (!temp_map)
-		return (false);
-	result = flood_fill(temp_map, (int)game->player.pos_y,
-			(int)game->player.pos_x, &game->map);
-	free_double_ptr(temp_map);
-	if (!result)
-		return (handle_parsing_error(game, ERR_MAP_NOT_CLOSED), false);
-	return (true);
-}
-
-/**
- * Create a temporary copy of the map for flood fill
- * Normalize all lines to the same width (pad with spaces)
+ * Flatten the grid into one byte per cell, 1 for walls and 0 for
+ * anything the fill may cross, allocated from the parse arena
  */
 
-char	**create_temp_map(t_map *game)
+static uint8_t	*create_flat_grid(t_map *map)
 {
-	char	**temp_map;
-	int		i;
-	int		j;
+	uint8_t	*cells;
+	uint8_t	*out;
+	int		x;
+	int		y;
 
-	i = -1;
-	temp_map = malloc(sizeof(char *) * (game->height + 1));
-	if (!temp_map)
+	cells = arena_alloc(&map->arena, (size_t)map->width * map->height);
+	if (!cells)
 		return (NULL);
-	while (++i < game->height)
+	out = cells;
+	y = -1;
+	while (++y < map->height)
 	{
-		temp_map[i] = malloc(sizeof(char) * (game->width + 1));
-		if (!temp_map[i])
-			return (free_double_ptr(temp_map), NULL);
-		j = -1;
-		while (++j < game->width)
-		{
-			if (j < (int)ft_strlen(game->grid[i]) && game->grid[i][j] != '\n')
-				temp_map[i][j] = game->grid[i][j];
-			else
-				temp_map[i][j] = ' ';
-		}
-		temp_map[i][game->width] = '\0';
+		x = -1;
+		while (++x < map->width)
+			*out++ = (map->grid[y][x] == '1');
 	}
-	return (temp_map[game->height] = NULL, temp_map);
+	return (cells);
 }
 
 /**
- * Flood fill algorithm to check wall closure
- * Returns 0 if any empty space reaches the border
+ * Validate the map structure
+ * Checks that the region reachable from the player never touches the
+ * map border, walking through spaces as well as floor
+ * @param game Pointer to the game structure containing the map
+ * @return true if the map is valid, false otherwise
  */
 
-int	flood_fill(char **map, int y, int x, t_map *game)
+bool	validate_open_walls(t_game *game)
 {
-	if (y < 0 || y >= game->height || x < 0 || x >= game->width)
-		return (0);
-	if (map[y][x] == '1' || map[y][x] == 'X')
-		return (1);
-	if (map[y][x] == ' ' && (y == 0 || y == game->height - 1
-		|| x == 0 || x == game->width - 1))
-		return (0);
-	map[y][x] = 'X';
-	if (!flood_fill(map, y - 1, x, game)
-		|| !flood_fill(map, y + 1, x, game)
-		|| !flood_fill(map, y, x - 1, game)
-		|| !flood_fill(map, y, x + 1, game))
-		return (0);
-	return (1);
+	uint8_t	*cells;
+	bool	result;
+
+	cells = create_flat_grid(&game->map);
+	if (!cells)
+		return (false);
+	result = flood_fill(&game->map, cells, (int)game->player.pos_x,
+			(int)game->player.pos_y);
+	if (!result)
+		return (handle_parsing_error(game, ERR_MAP_NOT_CLOSED), false);
+	return (true);
 }
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_bands.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Character and closure checks for one band of rows
+ *
+ * The rows just above and below the band are read as halo rows for the
+ * closure check but never written, so bands can run concurrently. This is
+ * the same row rule the reader used to apply while streaming rows in; it
+ * moved here so it runs once per band in parallel instead of serially on
+ * the reading thread. A closed map still skips the flood fill, and a band
+ * stops checking closure at its first open row.
+ */
+
+static void	*scan_band(void *arg)
+{
+	t_band		*band;
+	char		**grid;
+	const char	*above;
+	int			width;
+	int			y;
+
+	band = arg;
+	grid = band->map->grid;
+	y = band->first;
+	while (y < band->last)
+	{
+		width = scan_row(grid[y], y, band);
+		if (width > band->width)
+			band->width = width;
+		above = NULL;
+		if (y > 0)
+			above = grid[y - 1];
+		if (band->closed)
+			band->closed = is_enclosed_row(above, grid[y], grid[y + 1]);
+		y++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief map.threads bands, or one per online CPU when it is 0, but never
+ * fewer than MAP_BAND_MIN_ROWS rows per band
+ */
+
+static int	count_bands(t_map *map)
+{
+	long	count;
+
+	count = map->threads;
+	if (count < 1)
+		count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (count > MAP_MAX_THREADS)
+		count = MAP_MAX_THREADS;
+	if (count > map->row_count / MAP_BAND_MIN_ROWS)
+		count = map->row_count / MAP_BAND_MIN_ROWS;
+	if (count < 1)
+		count = 1;
+	return (count);
+}
+
+/**
+ * @brief Run band 0 on the calling thread and the others on their own;
+ * a band whose thread cannot be started runs inline instead
+ */
+
+static void	run_bands(t_band *bands, int count)
+{
+	pthread_t	threads[MAP_MAX_THREADS];
+	int			started[MAP_MAX_THREADS];
+	int			i;
+
+	i = 0;
+	while (++i < count)
+		started[i] = !pthread_create(&threads[i], NULL, scan_band, &bands[i]);
+	scan_band(&bands[0]);
+	i = 0;
+	while (++i < count)
+	{
+		if (started[i])
+			pthread_join(threads[i], NULL);
+		else
+			scan_band(&bands[i]);
+	}
+}
+
+static void	merge_bands(t_game *game, t_band *bands, int count)
+{
+	int	players;
+	int	width;
+	int	i;
+
+	players = 0;
+	width = 0;
+	game->map.rows_closed = 1;
+	i = -1;
+	while (++i < count)
+	{
+		players += bands[i].players;
+		if (bands[i].width > width)
+			width = bands[i].width;
+		if (bands[i].player_dir)
+			set_player_position(game, bands[i].player_dir,
+				bands[i].player_row, bands[i].player_col);
+		game->map.rows_closed &= bands[i].closed;
+	}
+	game->map.width = 0;
+	game->map.height = 0;
+	if (players == 1)
+	{
+		game->map.width = width;
+		game->map.height = game->map.row_count;
+	}
+}
+
+/**
+ * @brief Measure the map, find the player and check closure, splitting
+ * the grid into up to map.threads horizontal bands
+ */
+
+void	calculate_map_dimensions(t_game *game)
+{
+	t_band	bands[MAP_MAX_THREADS];
+	int		count;
+	int		i;
+
+	count = count_bands(&game->map);
+	ft_bzero(bands, sizeof(t_band) * count);
+	i = -1;
+	while (++i < count)
+	{
+		bands[i].map = &game->map;
+		bands[i].first = (long)game->map.row_count * i / count;
+		bands[i].last = (long)game->map.row_count * (i + 1) / count;
+		bands[i].closed = 1;
+	}
+	run_bands(bands, count);
+	merge_bands(game, bands, count);
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_rows.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Double the capacity of the row view array inside the arena
+ */
+
+static int	grow_row_views(t_map *map)
+{
+	t_row_view	*rows;
+	int			capacity;
+
+	capacity = map->row_capacity * 2;
+	if (capacity == 0)
+		capacity = 64;
+	rows = arena_alloc(&map->arena, sizeof(t_row_view) * capacity);
+	if (!rows)
+		return (0);
+	if (map->row_count)
+		ft_memcpy(rows, map->rows, sizeof(t_row_view) * map->row_count);
+	map->rows = rows;
+	map->row_capacity = capacity;
+	return (1);
+}
+
+/**
+ * @brief Record one map row as a view; blank lines become " "
+ *
+ * The text must stay alive until finish_map_rows, which is the only
+ * place rows are copied into the grid.
+ */
+
+void	append_map_row(t_game *game, const char *text, size_t len)
+{
+	t_map	*map;
+
+	map = &game->map;
+	if (map->row_count == map->row_capacity && !grow_row_views(map))
+		handle_parsing_error(game, ERR_MALLOC);
+	if (len == 0)
+	{
+		text = " ";
+		len = 1;
+	}
+	map->rows[map->row_count].text = text;
+	map->rows[map->row_count].len = len;
+	map->row_count++;
+}
+
+static char	*build_grid_row(t_row_view *view, int width)
+{
+	char	*row;
+
+	row = malloc(width + 1);
+	if (!row)
+		return (NULL);
+	ft_memcpy(row, view->text, view->len);
+	ft_memset(row + view->len, ' ', width - view->len);
+	row[width] = '\0';
+	return (row);
+}
+
+/**
+ * @brief Copy the collected rows into the grid, padded to the widest row
+ */
+
+void	finish_map_rows(t_game *game)
+{
+	t_map	*map;
+	int		width;
+	int		i;
+
+	map = &game->map;
+	map->grid = ft_calloc(map->row_count + 1, sizeof(char *));
+	if (!map->grid)
+		handle_parsing_error(game, ERR_MALLOC);
+	width = 0;
+	i = -1;
+	while (++i < map->row_count)
+		if ((int)map->rows[i].len > width)
+			width = map->rows[i].len;
+	i = -1;
+	while (++i < map->row_count)
+	{
+		map->grid[i] = build_grid_row(&map->rows[i], width);
+		if (!map->grid[i])
+			handle_parsing_error(game, ERR_MALLOC);
+	}
+}
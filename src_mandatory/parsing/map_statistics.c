@@ -44,7 +44,15 @@ void	set_player_position(t_game *game, char direction,
 	}
 }
 
-int	scan_row(char *row, t_scan_data *data)
+/**
+ * @brief Scan one row for the player and invalid characters
+ *
+ * Invalid characters bump the player count too, so any of them makes
+ * the count differ from one. The player is recorded in the band rather
+ * than the game so bands can run concurrently.
+ */
+
+int	scan_row(char *row, int y, t_band *band)
 {
 	int	c;
 
@@ -53,56 +61,18 @@ int	scan_row(char *row, t_scan_data *data)
 	{
 		if (is_character_valid(row[c], "NSEW"))
 		{
-			set_player_position(data->game, row[c],
-				data->row, data->base + c);
-			(*data->player_count)++;
+			band->player_dir = row[c];
+			band->player_row = y;
+			band->player_col = c;
+			band->players++;
 		}
 		if (!is_character_valid(row[c], "10 \nNSEW"))
-			(*data->player_count)++;
+			band->players++;
 		c++;
 	}
 	return (c);
 }
 
-static void	set_map_dimensions(t_game *game, int pc, int max_w, int row)
-{
-	if (pc == 1)
-	{
-		game->map.width = max_w;
-		game->map.height = row;
-	}
-	else
-	{
-		game->map.width = 0;
-		game->map.height = 0;
-	}
-}
-
-void	calculate_map_dimensions(t_game *game, char **map, int srow, int scol)
-{
-	int			row;
-	int			max_w;
-	int			pc;
-	int			w;
-	t_scan_data	data;
-
-	row = srow;
-	max_w = 0;
-	pc = 0;
-	data.game = game;
-	data.player_count = &pc;
-	while (map[row])
-	{
-		data.row = row;
-		data.base = scol;
-		w = scan_row(map[row] + scol, &data);
-		if (w > max_w)
-			max_w = w;
-		row++;
-	}
-	set_map_dimensions(game, pc, max_w, row);
-}
-
 /**
  * @brief Validate that all required configuration elements are present
  */
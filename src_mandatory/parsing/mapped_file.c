@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mapped_file.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Map a regular .cub file privately so lines can be cut in place
+ * @return 1 when mapped, 0 when the caller should fall back to reading
+ */
+
+int	map_cub_file(int fd, t_map *map)
+{
+	struct stat	info;
+	void		*data;
+
+	if (fstat(fd, &info) < 0 || !S_ISREG(info.st_mode) || info.st_size <= 0)
+		return (0);
+	data = mmap(NULL, info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+			fd, 0);
+	if (data == MAP_FAILED)
+		return (0);
+	map->file_data = data;
+	map->file_size = info.st_size;
+	return (1);
+}
+
+void	unmap_cub_file(t_map *map)
+{
+	stop_chunk_pager(map);
+	if (map->file_data)
+		munmap(map->file_data, map->file_size);
+	map->file_data = NULL;
+	map->file_size = 0;
+}
+
+/**
+ * @brief NUL-terminate a header line in place over its newline; only an
+ * unterminated last line has to be copied
+ */
+
+static char	*header_line_view(t_game *g, char *line, size_t len)
+{
+	char	*copy;
+
+	if (len == 0)
+		return (" ");
+	if (line + len < g->map.file_data + g->map.file_size)
+	{
+		line[len] = '\0';
+		return (line);
+	}
+	copy = arena_strndup(&g->map.arena, line, len);
+	if (!copy)
+		handle_parsing_error(g, ERR_MALLOC);
+	return (copy);
+}
+
+/**
+ * @brief Feed one line view to the parser; map rows stay views into the
+ * mapping until finish_map_rows copies them into the grid
+ */
+
+static void	process_line_view(t_game *g, char *line, size_t len, int *parsing)
+{
+	if (!*parsing)
+		*parsing = extract_map_statistics(g, header_line_view(g, line, len));
+	if (*parsing)
+		append_map_row(g, line, len);
+}
+
+/**
+ * @brief Parse a mapped .cub file by scanning its lines with memchr
+ */
+
+int	scan_mapped_cub_file(t_game *g)
+{
+	char	*cursor;
+	char	*end;
+	char	*newline;
+	int		parsing;
+
+	parsing = 0;
+	cursor = g->map.file_data;
+	end = cursor + g->map.file_size;
+	while (cursor < end)
+	{
+		newline = ft_memchr(cursor, '\n', end - cursor);
+		if (!newline)
+			newline = end;
+		process_line_view(g, cursor, newline - cursor, &parsing);
+		cursor = newline + 1;
+	}
+	finish_map_rows(g);
+	unmap_cub_file(&g->map);
+	return (1);
+}
@@ -12,52 +12,66 @@
 
 #include "../../includes_mandatory/cub3d.h"
 
-int	parse_and_validate_rgb_values(int *rgb, char *rgb_line)
+/**
+ * @brief Read one decimal component, failing as soon as it passes 255 so
+ * long digit runs cannot overflow
+ * @return Number of digits read, or 0 if there were none or too many
+ */
+
+static int	read_rgb_component(const t_token *token, size_t *i, int *value)
 {
-	char	**parts;
-	int		n;
-	int		i;
-	int		val;
-
-	if (!validate_rgb_line_format(rgb_line))
-		return (0);
-	parts = ft_split(rgb_line, ',');
-	if (!parts)
-		return (0);
-	n = count_elems(parts);
-	if (n != 3)
-		return (free_string_array(parts), 0);
-	i = -1;
-	while (++i < 3)
+	int	digits;
+
+	*value = 0;
+	digits = 0;
+	while (*i < token->len && ft_isdigit((unsigned char)token->start[*i]))
 	{
-		strip_trailing_nl(parts[i]);
-		if (!is_number(parts[i]))
-			return (free_string_array(parts), 0);
-		val = ft_atoi(parts[i]);
-		if (val < 0 || val > 255)
-			return (free_string_array(parts), 0);
-		rgb[i] = val;
+		*value = *value * 10 + token->start[*i] - '0';
+		if (*value > 255)
+			return (0);
+		(*i)++;
+		digits++;
 	}
-	return (free_string_array(parts), 1);
+	return (digits);
 }
 
-void	extract_rgb_colors(t_game *game, int *rgb, char **split_line)
+/**
+ * @brief Parse "R,G,B" in a single scan with the ranges checked inline
+ */
+
+int	parse_rgb_token(const t_token *token, int *rgb)
 {
-	int	n;
+	size_t	i;
+	int		component;
 
-	n = count_elems(split_line);
-	if (n >= 1)
-		strip_trailing_nl(split_line[n - 1]);
-	if (n != 2)
+	i = 0;
+	component = 0;
+	while (component < 3)
 	{
-		free_string_array(split_line);
-		handle_parsing_error(game, "Error\nInvalid color definition format\n");
+		if (!read_rgb_component(token, &i, &rgb[component]))
+			return (0);
+		if (component < 2)
+		{
+			if (i >= token->len || token->start[i] != ',')
+				return (0);
+			i++;
+		}
+		component++;
 	}
-	if (!parse_and_validate_rgb_values(rgb, split_line[1]))
-	{
-		free_string_array(split_line);
+	return (i == token->len);
+}
+
+void	extract_rgb_colors(t_game *game, int *rgb, char *config_line)
+{
+	t_token	tokens[2];
+	int		values[3];
+
+	if (tokenize_header_line(config_line, tokens, 2) != 2)
+		handle_parsing_error(game, "Error\nInvalid color definition format\n");
+	if (!parse_rgb_token(&tokens[1], values))
 		handle_parsing_error(game,
 			"Error\nInvalid RGB color values (must be 0-255)\n");
-	}
-	free_string_array(split_line);
+	rgb[0] = values[0];
+	rgb[1] = values[1];
+	rgb[2] = values[2];
 }
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scanline_fill.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+static int	push_seed(t_fill_stack *stack, int x, int y)
+{
+	int		*grown;
+	size_t	capacity;
+
+	if (stack->count == stack->capacity)
+	{
+		capacity = stack->capacity * 2;
+		if (capacity == 0)
+			capacity = 256;
+		grown = malloc(sizeof(int) * 2 * capacity);
+		if (!grown)
+			return (0);
+		if (stack->seeds)
+			ft_memcpy(grown, stack->seeds, sizeof(int) * 2 * stack->count);
+		free(stack->seeds);
+		stack->seeds = grown;
+		stack->capacity = capacity;
+	}
+	stack->seeds[2 * stack->count] = x;
+	stack->seeds[2 * stack->count + 1] = y;
+	stack->count++;
+	return (1);
+}
+
+/**
+ * @brief Push one seed per open run of row[left..right]
+ */
+
+static int	push_open_runs(t_fill_stack *stack, uint8_t *row,
+		int *span, int y)
+{
+	int	x;
+
+	x = span[0];
+	while (x <= span[1])
+	{
+		if (!row[x] && (x == span[0] || row[x - 1])
+			&& !push_seed(stack, x, y))
+			return (0);
+		x++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Fill the horizontal run through (x, y) and seed the rows around
+ * @return 0 if the run touches the map border (or memory ran out)
+ */
+
+static int	fill_span(t_map *map, uint8_t *cells, t_fill_stack *stack,
+		int *seed)
+{
+	uint8_t	*row;
+	int		span[2];
+
+	row = cells + (size_t)seed[1] * map->width;
+	if (row[seed[0]])
+		return (1);
+	span[0] = seed[0];
+	while (span[0] > 0 && !row[span[0] - 1])
+		span[0]--;
+	span[1] = seed[0];
+	while (span[1] < map->width - 1 && !row[span[1] + 1])
+		span[1]++;
+	if (span[0] == 0 || span[1] == map->width - 1
+		|| seed[1] == 0 || seed[1] == map->height - 1)
+		return (0);
+	ft_memset(row + span[0], 1, span[1] - span[0] + 1);
+	return (push_open_runs(stack, row - map->width, span, seed[1] - 1)
+		&& push_open_runs(stack, row + map->width, span, seed[1] + 1));
+}
+
+/**
+ * @brief Scanline flood fill from (x, y) over a flat grid where 0 is open
+ *
+ * Whole runs are filled per pop and only one seed per open run above and
+ * below is pushed, so the explicit stack grows with the region's outline
+ * rather than its area and nothing recurses.
+ * @return 1 if the region is closed, 0 if it reaches the map border
+ */
+
+int	flood_fill(t_map *map, uint8_t *cells, int x, int y)
+{
+	t_fill_stack	stack;
+	int				seed[2];
+	int				result;
+
+	ft_bzero(&stack, sizeof(stack));
+	result = push_seed(&stack, x, y);
+	while (result && stack.count)
+	{
+		stack.count--;
+		seed[0] = stack.seeds[2 * stack.count];
+		seed[1] = stack.seeds[2 * stack.count + 1];
+		result = fill_span(map, cells, &stack, seed);
+	}
+	free(stack.seeds);
+	return (result);
+}
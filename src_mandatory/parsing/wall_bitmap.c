@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wall_bitmap.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Occupancy bitmap derived from the validated grid
+ *
+ * The map is cut into 8x8 tiles and every tile is packed into a single
+ * 64-bit word (bit = local_y * 8 + local_x). Tiles are stored chunk by
+ * chunk: the 64 words of one 64x64-cell chunk are contiguous, so a chunk
+ * is 512 bytes that can be paged on its own, and a ray crossing a chunk
+ * stays inside a few cache lines. A 4096x4096 map costs 2 MiB instead
+ * of 16 MiB of chars.
+ *
+ * macro_bits repeats the trick one level up: one word per chunk with a
+ * bit per tile, set when the tile holds a wall, so one word answers "is
+ * this 64x64 block empty" for the hierarchical DDA.
+ */
+
+int	is_wall_cell(t_map *map, int x, int y)
+{
+	uint64_t	tile;
+
+	if (x < 0 || y < 0 || x >= map->width || y >= map->height)
+		return (1);
+	tile = map->wall_bits[(((size_t)(y >> 6) * map->macros_w + (x >> 6)) << 6)
+		| (y & 0x38) | ((x >> 3) & 7)];
+	return ((int)((tile >> (((y & 7) << 3) | (x & 7))) & 1));
+}
+
+static void	set_wall_bit(t_map *map, int x, int y)
+{
+	map->wall_bits[(((size_t)(y >> 6) * map->macros_w + (x >> 6)) << 6)
+		| (y & 0x38) | ((x >> 3) & 7)]
+		|= (uint64_t)1 << (((y & 7) << 3) | (x & 7));
+}
+
+/**
+ * @brief One macro word per chunk, bit i set when tile word i is not
+ * empty; a compiled map brings its macro words along, so only the empty
+ * chunks are counted then
+ */
+
+static void	build_macro_bitmap(t_game *game, t_map *map)
+{
+	size_t	chunk;
+	size_t	chunks;
+	int		i;
+
+	chunks = (size_t)map->macros_w * map->macros_h;
+	if (!map->macro_bits)
+	{
+		map->macro_bits = ft_calloc(chunks, sizeof(uint64_t));
+		if (!map->macro_bits)
+			handle_parsing_error(game,
+				"Error\nMemory allocation failed for wall bitmap\n");
+		chunk = -1;
+		while (++chunk < chunks)
+		{
+			i = -1;
+			while (++i < 64)
+				if (map->wall_bits[(chunk << 6) | i])
+					map->macro_bits[chunk] |= (uint64_t)1 << i;
+		}
+	}
+	map->empty_blocks = 0;
+	chunk = -1;
+	while (++chunk < chunks)
+		map->empty_blocks += (map->macro_bits[chunk] == 0);
+}
+
+static void	fill_wall_bitmap(t_game *game, t_map *map)
+{
+	int	x;
+	int	y;
+
+	map->wall_bits = ft_calloc((size_t)map->macros_w * map->macros_h * 64,
+			sizeof(uint64_t));
+	if (!map->wall_bits)
+		handle_parsing_error(game,
+			"Error\nMemory allocation failed for wall bitmap\n");
+	y = -1;
+	while (++y < map->height)
+	{
+		x = -1;
+		while (++x < map->width && map->grid[y][x])
+		{
+			if (map->grid[y][x] == '1')
+				set_wall_bit(map, x, y);
+		}
+	}
+}
+
+/**
+ * @brief Build both bitmap levels; a compiled map arrives with both
+ * already pointing into the .cubc file
+ */
+
+void	build_wall_bitmap(t_game *game)
+{
+	t_map	*map;
+
+	map = &game->map;
+	map->tiles_w = (map->width + 7) >> 3;
+	map->tiles_h = (map->height + 7) >> 3;
+	map->macros_w = (map->tiles_w + 7) >> 3;
+	map->macros_h = (map->tiles_h + 7) >> 3;
+	if (!map->wall_bits)
+		fill_wall_bitmap(game, map);
+	build_macro_bitmap(game, map);
+}
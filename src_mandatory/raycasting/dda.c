@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dda.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Same lookup as is_wall_cell, kept local so the DDA loop inlines it
+ * (rays never leave a validated, enclosed map, so no bounds check)
+ */
+
+static int	ray_cell_is_wall(t_map *map, int x, int y)
+{
+	uint64_t	tile;
+
+	tile = map->wall_bits[(((size_t)(y >> 6) * map->macros_w + (x >> 6)) << 6)
+		| (y & 0x38) | ((x >> 3) & 7)];
+	return ((int)((tile >> (((y & 7) << 3) | (x & 7))) & 1));
+}
+
+static void	advance_ray_one_cell(t_ray *ray)
+{
+	if (ray->side_dist_x < ray->side_dist_y)
+	{
+		ray->side_dist_x += ray->delta_dist_x;
+		ray->map_x += ray->step_x;
+		ray->side = 0;
+	}
+	else
+	{
+		ray->side_dist_y += ray->delta_dist_y;
+		ray->map_y += ray->step_y;
+		ray->side = 1;
+	}
+}
+
+/**
+ * @brief Plain DDA inside a 64x64 block that holds at least one wall
+ * @return 1 on a wall hit, 0 once the ray has left the block
+ */
+
+static int	walk_occupied_block(t_ray *ray, t_map *map)
+{
+	int	block_x;
+	int	block_y;
+
+	block_x = ray->map_x >> 6;
+	block_y = ray->map_y >> 6;
+	while (1)
+	{
+		advance_ray_one_cell(ray);
+		if (ray_cell_is_wall(map, ray->map_x, ray->map_y))
+			return (1);
+		if ((ray->map_x >> 6) != block_x || (ray->map_y >> 6) != block_y)
+			return (0);
+	}
+}
+
+/**
+ * @brief Hierarchical walk: empty 64x64 blocks are crossed in one jump and
+ * plain cell steps are only taken inside blocks that hold a wall
+ */
+
+static void	walk_block_hierarchy(t_ray *ray, t_map *map)
+{
+	while (1)
+	{
+		if (map->macro_bits[(size_t)(ray->map_y >> 6) * map->macros_w
+			+ (ray->map_x >> 6)] == 0)
+		{
+			skip_empty_block(ray, 64);
+			if (ray_cell_is_wall(map, ray->map_x, ray->map_y))
+				return ;
+		}
+		else if (walk_occupied_block(ray, map))
+			return ;
+	}
+}
+
+/**
+ * @brief Walk the ray until it enters a wall cell
+ *
+ * The distance field is preferred when it was built. Otherwise maps where
+ * at least a quarter of the 64x64 blocks are empty use the block hierarchy
+ * and the rest keep the plain cell-by-cell DDA. The ray is walked through
+ * a local copy so the loop state stays in registers.
+ */
+
+void	execute_dda_algorithm(t_game *game)
+{
+	t_ray	ray;
+
+	ray = game->ray;
+	if (game->map.wall_distance)
+		walk_distance_field(&ray, &game->map);
+	else if (game->map.empty_blocks * 4
+		>= game->map.macros_w * game->map.macros_h)
+		walk_block_hierarchy(&ray, &game->map);
+	else
+	{
+		advance_ray_one_cell(&ray);
+		while (!ray_cell_is_wall(&game->map, ray.map_x, ray.map_y))
+			advance_ray_one_cell(&ray);
+	}
+	game->ray = ray;
+}
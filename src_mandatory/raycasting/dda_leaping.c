@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dda_leaping.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Walk the ray with the distance field
+ *
+ * At distance d the (2d - 1)-wide square around the cell is empty, so the
+ * ray leaves it in one jump; next to a wall (d == 1) this is a plain DDA
+ * step. The field doubles as the hit test: d == 0 is a wall.
+ */
+
+void	walk_distance_field(t_ray *ray, t_map *map)
+{
+	int	distance;
+
+	distance = map->wall_distance[(size_t)ray->map_y * map->width
+		+ ray->map_x];
+	while (1)
+	{
+		leave_open_area(ray, distance - 1, distance - 1);
+		distance = map->wall_distance[(size_t)ray->map_y * map->width
+			+ ray->map_x];
+		if (distance == 0)
+			return ;
+	}
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dda_skipping.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Cells left before the ray crosses the far edge of its block
+ */
+
+static int	cells_to_block_edge(int cell, int step, int block_size)
+{
+	if (step > 0)
+		return ((cell | (block_size - 1)) - cell);
+	return (cell & (block_size - 1));
+}
+
+/**
+ * @brief Jump to the first cell past the block's x edge at distance exit_x
+ *
+ * The y gridlines met on the way are the ones the plain DDA would have
+ * crossed first (ties go to y, as in advance_ray_one_cell).
+ */
+
+static void	leave_block_through_x(t_ray *ray, int cells_x, double exit_x)
+{
+	int	crossed_y;
+
+	crossed_y = 0;
+	if (exit_x >= ray->side_dist_y)
+		crossed_y = (int)((exit_x - ray->side_dist_y)
+				/ ray->delta_dist_y) + 1;
+	ray->map_y += crossed_y * ray->step_y;
+	ray->side_dist_y += crossed_y * ray->delta_dist_y;
+	ray->map_x += (cells_x + 1) * ray->step_x;
+	ray->side_dist_x = exit_x + ray->delta_dist_x;
+	ray->side = 0;
+}
+
+static void	leave_block_through_y(t_ray *ray, int cells_y, double exit_y)
+{
+	int	crossed_x;
+
+	crossed_x = 0;
+	if (exit_y > ray->side_dist_x)
+		crossed_x = (int)ceil((exit_y - ray->side_dist_x)
+				/ ray->delta_dist_x);
+	ray->map_x += crossed_x * ray->step_x;
+	ray->side_dist_x += crossed_x * ray->delta_dist_x;
+	ray->map_y += (cells_y + 1) * ray->step_y;
+	ray->side_dist_y = exit_y + ray->delta_dist_y;
+	ray->side = 1;
+}
+
+/**
+ * @brief Jump out of an empty area in one step
+ * @param cells_x empty cells ahead of the ray's cell along x
+ * @param cells_y empty cells ahead of the ray's cell along y
+ *
+ * With cells_x == cells_y == 0 this is exactly one plain DDA step.
+ */
+
+void	leave_open_area(t_ray *ray, int cells_x, int cells_y)
+{
+	double	exit_x;
+	double	exit_y;
+
+	exit_x = ray->side_dist_x + cells_x * ray->delta_dist_x;
+	exit_y = ray->side_dist_y + cells_y * ray->delta_dist_y;
+	if (exit_x < exit_y)
+		leave_block_through_x(ray, cells_x, exit_x);
+	else
+		leave_block_through_y(ray, cells_y, exit_y);
+}
+
+/**
+ * @brief Cross the empty, aligned block_size x block_size block that holds
+ * the ray's current cell in one jump
+ */
+
+void	skip_empty_block(t_ray *ray, int block_size)
+{
+	leave_open_area(ray,
+		cells_to_block_edge(ray->map_x, ray->step_x, block_size),
+		cells_to_block_edge(ray->map_y, ray->step_y, block_size));
+}
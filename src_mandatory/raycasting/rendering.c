@@ -14,10 +14,20 @@
 
 int	render_frame(t_game *game)
 {
-	process_movement_input(game);
+	take_pose_snapshot(game);
+	update_chunk_pager(game);
+	update_texture_residency(game);
 	render_background_colors(game);
 	execute_raycasting(game);
 	mlx_put_image_to_window(game->mlx.instance, game->mlx.window,
 		game->textures.screen.mlx_ptr, 0, 0);
+	if (game->session.mode == SESSION_REPLAY)
+		record_replay_frame(game);
+	if (game->view.input_us)
+		record_input_latency(game);
+	if (game->start_us)
+		print_first_frame_report(game);
+	if (game->startup.enabled && !game->textures.flat_columns)
+		finish_startup_report(game);
 	return (0);
 }
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   startup_report.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_mandatory/cub3d.h"
+
+/**
+ * @brief Process-wide malloc tally, bumped by __wrap_malloc where the
+ * linker supports wrapping (it stays 0 elsewhere)
+ */
+
+t_alloc_count	*alloc_counter(void)
+{
+	static t_alloc_count	counter;
+
+	return (&counter);
+}
+
+static void	read_alloc_counter(t_alloc_count *out)
+{
+	t_alloc_count	*c;
+
+	c = alloc_counter();
+	out->count = __atomic_load_n(&c->count, __ATOMIC_RELAXED);
+	out->bytes = __atomic_load_n(&c->bytes, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Turn on --startup-report; the first phase runs from launch
+ */
+
+void	start_startup_report(t_game *game)
+{
+	game->startup.enabled = 1;
+	game->startup.count = 0;
+	game->startup.mark_us = game->start_us;
+	read_alloc_counter(&game->startup.mark);
+}
+
+/**
+ * @brief Close the current phase under name and start the next one
+ * @return The current time (us), so callers can reuse it as a stamp
+ */
+
+long long	record_startup_phase(t_game *game, const char *name)
+{
+	t_startup		*s;
+	t_alloc_count	now;
+	long long		now_us;
+
+	now_us = get_time_us();
+	s = &game->startup;
+	if (!s->enabled || s->count == STARTUP_MAX_PHASES)
+		return (now_us);
+	read_alloc_counter(&now);
+	s->phases[s->count].name = name;
+	s->phases[s->count].path = NULL;
+	s->phases[s->count].us = now_us - s->mark_us;
+	s->phases[s->count].allocs = now.count - s->mark.count;
+	s->phases[s->count].bytes = now.bytes - s->mark.bytes;
+	s->count++;
+	s->mark_us = now_us;
+	s->mark = now;
+	return (now_us);
+}
+
+/**
+ * @brief Note how long a wall texture took from the first column that
+ * asked for it until it was uploaded
+ */
+
+void	record_texture_phase(t_game *game, t_tex_entry *e)
+{
+	t_startup	*s;
+
+	s = &game->startup;
+	if (!s->enabled || s->count == STARTUP_MAX_PHASES)
+		return ;
+	ft_bzero(&s->phases[s->count], sizeof(t_phase));
+	s->phases[s->count].name = "texture";
+	s->phases[s->count].path = e->path;
+	s->phases[s->count].us = get_time_us() - e->requested_us;
+	s->count++;
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   startup_report_print.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_mandatory/cub3d.h"
+
+static void	print_json_string(const char *str)
+{
+	printf("\"");
+	while (*str)
+	{
+		if (*str == '"' || *str == '\\')
+			printf("\\%c", *str);
+		else if ((unsigned char)*str < 0x20)
+			printf("\\u%04x", (unsigned char)*str);
+		else
+			printf("%c", *str);
+		str++;
+	}
+	printf("\"");
+}
+
+static void	print_startup_table(t_startup *s, t_phase *total)
+{
+	int	i;
+
+	printf("Startup report: %.2f ms, %zu allocations, %zu bytes\n",
+		total->us / 1000.0, total->allocs, total->bytes);
+	i = -1;
+	while (++i < s->count)
+	{
+		if (s->phases[i].path)
+			printf("    %-14s %9.2f ms  %s\n", s->phases[i].name,
+				s->phases[i].us / 1000.0, s->phases[i].path);
+		else
+			printf("  %-16s %9.2f ms %8zu allocs %12zu bytes\n",
+				s->phases[i].name, s->phases[i].us / 1000.0,
+				s->phases[i].allocs, s->phases[i].bytes);
+	}
+}
+
+/**
+ * @brief The same rows as one JSON line, for scripts
+ */
+
+static void	print_startup_json(t_startup *s, t_phase *total)
+{
+	int	i;
+
+	printf("{\"startup\":{\"ms\":%.3f,\"allocs\":%zu,\"bytes\":%zu,"
+		"\"phases\":[", total->us / 1000.0, total->allocs, total->bytes);
+	i = -1;
+	while (++i < s->count)
+	{
+		if (i)
+			printf(",");
+		printf("{\"name\":");
+		print_json_string(s->phases[i].name);
+		if (s->phases[i].path)
+		{
+			printf(",\"path\":");
+			print_json_string(s->phases[i].path);
+		}
+		printf(",\"ms\":%.3f", s->phases[i].us / 1000.0);
+		if (!s->phases[i].path)
+			printf(",\"allocs\":%zu,\"bytes\":%zu", s->phases[i].allocs,
+				s->phases[i].bytes);
+		printf("}");
+	}
+	printf("]}}\n");
+}
+
+/**
+ * @brief Print --startup-report once the first fully textured frame is
+ * on screen
+ *
+ * The last phase covers the frames spent waiting for the visible wall
+ * textures. Texture rows overlap the phases around them, so the totals
+ * only add up the sequential ones.
+ */
+
+void	finish_startup_report(t_game *game)
+{
+	t_startup	*s;
+	t_phase		total;
+	int			i;
+
+	record_startup_phase(game, "wall textures");
+	s = &game->startup;
+	ft_bzero(&total, sizeof(total));
+	i = -1;
+	while (++i < s->count)
+	{
+		if (!s->phases[i].path)
+		{
+			total.us += s->phases[i].us;
+			total.allocs += s->phases[i].allocs;
+			total.bytes += s->phases[i].bytes;
+		}
+	}
+	print_startup_table(s, &total);
+	print_startup_json(s, &total);
+	s->enabled = 0;
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   closure_check.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "closure_check.h"
+
+/**
+ * @brief The row rule applied top to bottom, one row at a time, as the
+ * streaming check did while the rows were read
+ */
+
+static int	rows_enclosed(t_map *map)
+{
+	const char	*above;
+	int			y;
+
+	y = -1;
+	while (++y < map->height)
+	{
+		above = NULL;
+		if (y > 0)
+			above = map->grid[y - 1];
+		if (!is_enclosed_row(above, map->grid[y], map->grid[y + 1]))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief Open each wall of the map in turn and compare the reference
+ * validators with the row rule on every variant
+ * @return Number of variants they disagree on; walls counts the variants
+ */
+
+static int	compare_open_walls(t_game *game, int *walls)
+{
+	char	**grid;
+	int		differs;
+	int		x;
+	int		y;
+
+	grid = game->map.grid;
+	differs = 0;
+	*walls = 0;
+	y = -1;
+	while (++y < game->map.height)
+	{
+		x = -1;
+		while (++x < game->map.width)
+		{
+			if (grid[y][x] == '1')
+			{
+				grid[y][x] = ' ';
+				differs += (validate_rows(game) && validate_cols(game))
+					!= rows_enclosed(&game->map);
+				grid[y][x] = '1';
+				(*walls)++;
+			}
+		}
+	}
+	return (differs);
+}
+
+/**
+ * @brief Compare the reference validators with is_enclosed_row, row by
+ * row and through the band scan, on one parsed map and its variants
+ * @return 1 when they disagree
+ */
+
+static int	compare_closure(char *path, t_game *game)
+{
+	int	reference;
+	int	streamed;
+	int	differs;
+	int	walls;
+
+	reference = validate_rows(game) && validate_cols(game);
+	streamed = rows_enclosed(&game->map);
+	differs = compare_open_walls(game, &walls);
+	if (reference == streamed && reference == game->map.rows_closed
+		&& !differs)
+	{
+		printf("OK   %s: closed %d, %d opened walls agree\n", path,
+			reference, walls);
+		return (0);
+	}
+	printf("DIFF %s: reference %d, rows %d, bands %d, %d of %d opened "
+		"walls differ\n", path, reference, streamed, game->map.rows_closed,
+		differs, walls);
+	return (1);
+}
+
+/**
+ * @brief Parse path up to its dimensions with map.bail armed, then
+ * compare; maps the parser rejects first are only listed
+ */
+
+static int	check_map(char *path)
+{
+	t_game	game;
+	jmp_buf	bail;
+	int		fd;
+	int		differs;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (printf("Error\n%s: %s\n", ERR_FILE_OPEN, path), 1);
+	init_game_structure(&game);
+	game.map.bail = &bail;
+	differs = 0;
+	if (setjmp(bail) == 0)
+	{
+		read_and_parse_map_file(fd, &game);
+		normalize_map_dimensions(&game);
+		differs = compare_closure(path, &game);
+		cleanup_parsing_error(&game);
+	}
+	else
+		printf("SKIP %s: %s", path, game.map.error);
+	get_next_line_release(fd);
+	close(fd);
+	return (differs);
+}
+
+/**
+ * @brief closure_check map.cub...: check that is_enclosed_row accepts
+ * exactly the maps validate_rows and validate_cols accepted
+ */
+
+int	main(int argc, char **argv)
+{
+	int	differs;
+	int	i;
+
+	differs = 0;
+	i = 0;
+	while (++i < argc)
+		differs += check_map(argv[i]);
+	printf("%d maps, %d disagreements\n", argc - 1, differs);
+	return (differs != 0);
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   collision_bench.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes_bonus/cub3d.h"
+
+static uint64_t	next_random(uint64_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return (*state);
+}
+
+static double	random_unit(uint64_t *state)
+{
+	return ((next_random(state) >> 11) * (1.0 / 9007199254740992.0));
+}
+
+/**
+ * @brief Start somewhere inside a random open cell, far enough from its
+ * edges that the circle does not overlap a wall yet
+ */
+
+static void	random_open_spot(t_map *map, uint64_t *state, double *pos)
+{
+	int	x;
+	int	y;
+
+	x = (int)(next_random(state) % (uint64_t)map->width);
+	y = (int)(next_random(state) % (uint64_t)map->height);
+	while (is_wall_cell(map, x, y))
+	{
+		x = (int)(next_random(state) % (uint64_t)map->width);
+		y = (int)(next_random(state) % (uint64_t)map->height);
+	}
+	pos[0] = x + PLAYER_RADIUS + random_unit(state)
+		* (1.0 - 2.0 * PLAYER_RADIUS);
+	pos[1] = y + PLAYER_RADIUS + random_unit(state)
+		* (1.0 - 2.0 * PLAYER_RADIUS);
+}
+
+/**
+ * @brief Time COLLISION_BENCH_QUERIES slides of up to step cells in a
+ * random direction from random open spots; the spots are drawn up front
+ * so only slide_circle is inside the timed loop
+ */
+
+static void	time_collision_queries(t_map *map, double step, double *spots)
+{
+	uint64_t	state;
+	long long	start;
+	double		sum;
+	int			i;
+
+	state = 0x9e3779b97f4a7c15ULL;
+	i = -1;
+	while (++i < COLLISION_BENCH_QUERIES)
+	{
+		random_open_spot(map, &state, spots + i * 4);
+		spots[i * 4 + 2] = (random_unit(&state) * 2.0 - 1.0) * step;
+		spots[i * 4 + 3] = (random_unit(&state) * 2.0 - 1.0) * step;
+	}
+	start = get_time_us();
+	i = -1;
+	while (++i < COLLISION_BENCH_QUERIES)
+		slide_circle(map, spots + i * 4, spots[i * 4 + 2], spots[i * 4 + 3]);
+	start = get_time_us() - start;
+	sum = 0.0;
+	while (--i >= 0)
+		sum += spots[i * 4] + spots[i * 4 + 1];
+	printf("Collision: %d queries, step %.2f, %.1f ms, %.2f M queries/s "
+		"(checksum %.3f)\n", COLLISION_BENCH_QUERIES, step, start / 1000.0,
+		COLLISION_BENCH_QUERIES / (double)start, sum);
+}
+
+/**
+ * @brief collision_bench map.cub: parse the map without opening a window
+ * and time the swept-circle solver at a frame-sized step and at a step
+ * long enough to cross several cells
+ */
+
+int	main(int argc, char **argv)
+{
+	t_game	game;
+	double	*spots;
+	int		fd;
+
+	if (argc != 2 || !has_file_extension(argv[1], ".cub"))
+		return (printf("Error\nUsage: %s <map.cub>\n", argv[0]), 1);
+	fd = open(argv[1], O_RDONLY);
+	if (fd < 0)
+		return (printf("Error\n%s: %s\n", ERR_FILE_OPEN, argv[1]), 1);
+	init_game_structure(&game);
+	read_and_parse_map_file(fd, &game);
+	close(fd);
+	normalize_map_dimensions(&game);
+	validate_parsed_map(&game);
+	build_wall_bitmap(&game);
+	spots = malloc(sizeof(double) * 4 * COLLISION_BENCH_QUERIES);
+	if (spots)
+	{
+		time_collision_queries(&game.map, MOVE_SPEED * 2.0, spots);
+		time_collision_queries(&game.map, 2.0, spots);
+	}
+	free(spots);
+	cleanup_parsing_error(&game);
+	return (!spots);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_bench.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gansari <gansari@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by gansari           #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by gansari          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../Libft/libft.h"
+#include <sys/time.h>
+
+static long long	now_us(void)
+{
+	struct timeval	now;
+
+	gettimeofday(&now, NULL);
+	return ((long long)now.tv_sec * 1000000LL + now.tv_usec);
+}
+
+/**
+ * @brief Fill path with lines of line_len characters until it holds
+ * about size bytes; a line_len of 0 writes one line of size bytes
+ */
+
+static int	write_sample(const char *path, size_t size, size_t line_len)
+{
+	char	*line;
+	size_t	written;
+	int		fd;
+
+	if (line_len == 0)
+		line_len = size;
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+	if (fd < 0)
+		return (0);
+	line = malloc(line_len + 1);
+	if (line)
+		ft_memset(line, 'x', line_len);
+	if (line)
+		line[line_len] = '\n';
+	written = 0;
+	while (line && written < size && write(fd, line, line_len + 1) > 0)
+		written += line_len + 1;
+	free(line);
+	close(fd);
+	return (written >= size);
+}
+
+/**
+ * @brief Read path to its end with get_next_line, or with bare read()
+ * calls of BUFFER_SIZE as the floor to compare against
+ * @return Elapsed microseconds; lines counts what was read
+ */
+
+static long long	time_pass(const char *path, int use_gnl, size_t *lines)
+{
+	char		*line;
+	long long	start;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	line = malloc(BUFFER_SIZE);
+	*lines = 0;
+	start = now_us();
+	while (line && !use_gnl && read(fd, line, BUFFER_SIZE) > 0)
+		(*lines)++;
+	free(line);
+	line = NULL;
+	if (use_gnl)
+		line = get_next_line(fd);
+	while (line)
+	{
+		(*lines)++;
+		free(line);
+		line = get_next_line(fd);
+	}
+	start = now_us() - start;
+	close(fd);
+	return (start);
+}
+
+static void	bench_case(const char *path, size_t size, size_t line_len)
+{
+	long long	gnl_us;
+	long long	read_us;
+	size_t		lines;
+	size_t		blocks;
+
+	if (!write_sample(path, size, line_len))
+	{
+		printf("Error\nCannot write %s\n", path);
+		return ;
+	}
+	read_us = time_pass(path, 0, &blocks);
+	gnl_us = time_pass(path, 1, &lines);
+	if (line_len == 0)
+		line_len = size;
+	printf("%zu MiB, %zu-byte lines: %zu lines in %.1f ms (%.0f MiB/s), "
+		"read() alone %.1f ms\n", size >> 20, line_len, lines,
+		gnl_us / 1000.0, (size >> 20) / (gnl_us / 1000000.0),
+		read_us / 1000.0);
+}
+
+/**
+ * @brief gnl_bench [scratch file]: time get_next_line over multi-megabyte
+ * inputs of short lines, long lines and a single huge line
+ */
+
+int	main(int argc, char **argv)
+{
+	const char	*path;
+
+	path = "gnl_bench.tmp";
+	if (argc > 1)
+		path = argv[1];
+	bench_case(path, 64 << 20, 32);
+	bench_case(path, 64 << 20, 4096);
+	bench_case(path, 16 << 20, 0);
+	unlink(path);
+	return (0);
+}